@@ -242,12 +242,12 @@ void UButtonStaticMesh::UpdateButton(bool isOn)
 			if (AVRHand* foundHand = Cast<AVRHand>(buttonHit.GetActor()))
 			{
 				// If there is a haptic effect use it, otherwise use the default haptic effect (Handled in rumble controller function).
-				foundHand->PlayFeedback(hapticEffect);
+				foundHand->PlayFeedback(hapticEffect, 1.0f, false, 1);
 			}
 			else if (AGrabbableActor* foundGrabbable = Cast<AGrabbableActor>(buttonHit.GetActor()))
 			{
 				// Otherwise if there is a grabbable find the hand holding the grabbable and play haptic effect.
-				if (AVRHand* hand = foundGrabbable->otherGrabInfo.handRef) hand->PlayFeedback(hapticEffect);
+				if (AVRHand* hand = foundGrabbable->otherGrabInfo.handRef) hand->PlayFeedback(hapticEffect, 1.0f, false, 1);
 			}
 		}
 	}
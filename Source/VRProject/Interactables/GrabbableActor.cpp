@@ -8,6 +8,7 @@
 #include "Components/BoxComponent.h"
 #include "Components/AudioComponent.h"
 #include "Components/ChildActorComponent.h"
+#include "Interactables/GrabbableSubsystem.h"
 #include "Player/VRPlayer.h"
 #include "Player/VRHand.h"
 #include "Project/VRPhysicsHandleComponent.h"
@@ -66,6 +67,9 @@ void AGrabbableActor::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// Register so the hands can search for grabbables without a scene query.
+	if (UGrabbableSubsystem* registry = GetWorld()->GetSubsystem<UGrabbableSubsystem>()) registry->Register(this);
+
 	// Setup sounds for impacts.
 	if (impactSoundOverride)
 	{
@@ -167,6 +171,15 @@ void AGrabbableActor::ResetLastRumbleIntensity()
 	lastRumbleIntensity = 0.0f;
 }
 
+void AGrabbableActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	Super::EndPlay(EndPlayReason);
+
+	// Remove this grabbable from its worlds registry and any hands cached interface owners.
+	if (UGrabbableSubsystem* registry = GetWorld()->GetSubsystem<UGrabbableSubsystem>()) registry->Unregister(this);
+	AVRHand::InvalidateInterfaceCache();
+}
+
 void AGrabbableActor::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
@@ -203,7 +216,12 @@ void AGrabbableActor::PickupPhysicsHandle(FGrabInformation info, bool secondHand
 	}
 
 	// Grab. Increase stabilization while grabbed to prevent visual errors or snapping...
-	info.handRef->grabHandle->CreateJointAndFollowLocationWithRotation(grabbableMesh, info.targetComponent, NAME_None, locationToGrab, rotationToGrab, interactableSettings.physicsData);
+	// If the handle is already holding the mesh, for example from a telekinetic pull, move the existing joint instead of re-creating it.
+	if (info.handRef->grabHandle->grabbedComponent == grabbableMesh)
+	{
+		info.handRef->grabHandle->RetargetJoint(info.targetComponent, locationToGrab, rotationToGrab, true, interactableSettings.physicsData);
+	}
+	else info.handRef->grabHandle->CreateJointAndFollowLocationWithRotation(grabbableMesh, info.targetComponent, NAME_None, locationToGrab, rotationToGrab, interactableSettings.physicsData);
 	grabbableMesh->SetSimulatePhysics(true);
 
 	// Setup second hand after attachment.
@@ -271,6 +289,7 @@ void AGrabbableActor::Grabbed_Implementation(AVRHand* hand)
 			if (grabbableMesh->GetAttachParent())
 			{
 				grabbableMesh->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+				AVRHand::InvalidateInterfaceCache();
 			}
 
 			// Grab via physics handle.
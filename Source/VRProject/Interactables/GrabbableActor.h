@@ -189,6 +189,9 @@ protected:
 	/** Level Start */
 	virtual void BeginPlay() override;
 
+	/** Level End */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 private:
 
 	/** Binded event to this actors hit response delegate. */
@@ -227,6 +230,9 @@ public:
 	virtual void EndOverlapping_Implementation(AVRHand* hand) override;
 	virtual void Teleported_Implementation() override;
 
+	/** Events handled by this classes implementation, used by the interaction dispatch functions. */
+	INTERACTION_EVENTS_BODY(AGrabbableActor)
+
 	/**  Get and set functions to allow changes from blueprint. */
 	virtual FInterfaceSettings GetInterfaceSettings_Implementation() override;
 	virtual void SetInterfaceSettings_Implementation(FInterfaceSettings newInterfaceSettings) override;
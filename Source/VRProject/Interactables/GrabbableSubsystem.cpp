@@ -0,0 +1,14 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Interactables/GrabbableSubsystem.h"
+#include "Interactables/GrabbableActor.h"
+
+void UGrabbableSubsystem::Register(AGrabbableActor* grabbable)
+{
+	grabbables.AddUnique(grabbable);
+}
+
+void UGrabbableSubsystem::Unregister(AGrabbableActor* grabbable)
+{
+	grabbables.RemoveAllSwap([grabbable](const TWeakObjectPtr<AGrabbableActor>& registered) { return !registered.IsValid() || registered.Get() == grabbable; });
+}
@@ -0,0 +1,33 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GrabbableSubsystem.generated.h"
+
+/** Define classes used. */
+class AGrabbableActor;
+
+/** Per world registry of the grabbables in play, used by the hands to search for grabbables without a scene query.
+ * NOTE: Each world has its own registry so PIE clients, servers and editor preview worlds never see each others grabbables. */
+UCLASS()
+class VRPROJECT_API UGrabbableSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+private:
+
+	TArray<TWeakObjectPtr<AGrabbableActor>> grabbables; /** Every grabbable that has begun play in this world. */
+
+public:
+
+	/** Add a grabbable to this worlds registry. */
+	void Register(AGrabbableActor* grabbable);
+
+	/** Remove a grabbable from this worlds registry along with any that were destroyed without ending play. */
+	void Unregister(AGrabbableActor* grabbable);
+
+	/** @Return every grabbable currently in play in this world.
+	 * NOTE: Entries are weak and are removed when their grabbable ends play. */
+	FORCEINLINE const TArray<TWeakObjectPtr<AGrabbableActor>>& GetGrabbables() const { return grabbables; }
+};
@@ -1,6 +1,7 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "Interactables/InteractableActor.h"
+#include "Player/VRHand.h"
 
 DEFINE_LOG_CATEGORY(LogInteractable);
 
@@ -22,6 +23,14 @@ void AInteractableActor::BeginPlay()
 	//...
 }
 
+void AInteractableActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	Super::EndPlay(EndPlayReason);
+
+	// Remove this interactable from any hands cached interface owners.
+	AVRHand::InvalidateInterfaceCache();
+}
+
 void AInteractableActor::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
@@ -35,6 +35,9 @@ protected:
 	/** Level Start. */
 	virtual void BeginPlay() override;
 
+	/** Level End. */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 public:
 
 	/** Constructor. */
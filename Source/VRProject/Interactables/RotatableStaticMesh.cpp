@@ -420,6 +420,18 @@ bool URotatableStaticMesh::CanEditChange(const FProperty* InProperty) const
 }
 #endif
 
+void URotatableStaticMesh::OnAttachmentChanged()
+{
+	Super::OnAttachmentChanged();
+	AVRHand::InvalidateInterfaceCache();
+}
+
+void URotatableStaticMesh::OnComponentDestroyed(bool bDestroyingHierarchy)
+{
+	Super::OnComponentDestroyed(bDestroyingHierarchy);
+	AVRHand::InvalidateInterfaceCache();
+}
+
 void URotatableStaticMesh::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
@@ -693,7 +705,7 @@ void URotatableStaticMesh::Lock(float lockingAngle)
 		// If lock haptic effect is enable and not null play on hand then release. Also play sound.
 		if (handRef)
 		{
-			if (lockHapticEffect) handRef->PlayFeedback(lockHapticEffect, 1.0f);
+			if (lockHapticEffect) handRef->PlayFeedback(lockHapticEffect, 1.0f, false, 1);
 			if (releaseWhenLocked) handRef->ReleaseGrabbedActor();
 		}
 
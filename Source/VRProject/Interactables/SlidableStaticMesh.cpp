@@ -53,6 +53,18 @@ void USlidableStaticMesh::BeginPlay()
 	UpdateConstraintBounds();
 }
 
+void USlidableStaticMesh::OnAttachmentChanged()
+{
+	Super::OnAttachmentChanged();
+	AVRHand::InvalidateInterfaceCache();
+}
+
+void USlidableStaticMesh::OnComponentDestroyed(bool bDestroyingHierarchy)
+{
+	Super::OnComponentDestroyed(bDestroyingHierarchy);
+	AVRHand::InvalidateInterfaceCache();
+}
+
 void USlidableStaticMesh::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
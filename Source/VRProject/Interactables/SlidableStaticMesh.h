@@ -102,6 +102,10 @@ protected:
 	/** Level start. */
 	virtual void BeginPlay() override;
 
+	/** Invalidate the hands cached interface owners when attached, detached or destroyed. */
+	virtual void OnAttachmentChanged() override;
+	virtual void OnComponentDestroyed(bool bDestroyingHierarchy) override;
+
 public:
 
 	/** Constructor. */
@@ -139,6 +143,9 @@ public:
 	virtual void Overlapping_Implementation(AVRHand* hand) override;
 	virtual void EndOverlapping_Implementation(AVRHand* hand) override;
 
+	/** Events handled by this classes implementation, used by the interaction dispatch functions. */
+	INTERACTION_EVENTS_BODY(USlidableStaticMesh)
+
 	/**  Get and set functions to allow changes from blueprint. */
 	virtual FInterfaceSettings GetInterfaceSettings_Implementation() override;
 	virtual void SetInterfaceSettings_Implementation(FInterfaceSettings newInterfaceSettings) override;
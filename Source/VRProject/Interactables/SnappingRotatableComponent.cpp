@@ -121,6 +121,7 @@ void USnappingRotatableComponent::OverlapBegin(UPrimitiveComponent* OverlappedCo
 			// Snap grabbable to the start of the sliding mesh.
 			grabbableActor->grabbableMesh->SetSimulatePhysics(false);
 			grabbableActor->AttachToComponent(rotatableMesh, FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+			AVRHand::InvalidateInterfaceCache();
 			grabbableActor->grabbableMesh->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
 			grabbableActor->grabbableMesh->SetRelativeLocationAndRotation(locationOffset, rotationOffset);
 
@@ -185,7 +186,7 @@ void USnappingRotatableComponent::OnGrabbableGrabbed(AVRHand* hand)
 		snappedGrabbable->cancelGrab = true;
 
 		// Fix for highlighting not disabling after grabbing.
-		IInteractionInterface::Execute_EndOverlapping(snappedGrabbable, hand);
+		IInteractionInterface::Dispatch_EndOverlapping(snappedGrabbable, hand);
 
 		// Force grab on the rotatable mesh instead.
 		hand->ForceGrab(rotatableMesh);
@@ -207,6 +208,7 @@ void USnappingRotatableComponent::ForceSnap(AGrabbableActor* actorToSnap)
 		// Snap grabbable to the start of the sliding mesh.
 		snappedGrabbable->grabbableMesh->SetSimulatePhysics(false);
 		snappedGrabbable->AttachToComponent(rotatableMesh, FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+		AVRHand::InvalidateInterfaceCache();
 		snappedGrabbable->grabbableMesh->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
 		snappedGrabbable->grabbableMesh->SetRelativeLocationAndRotation(locationOffset, rotationOffset);
 
@@ -222,6 +224,7 @@ void USnappingRotatableComponent::ForceRelease()
 		// Remove delegate before re-grabbed.
 		if (snappedGrabbable->OnMeshGrabbed.Contains(this, "OnGrabbableGrabbed")) snappedGrabbable->OnMeshGrabbed.RemoveDynamic(this, &USnappingRotatableComponent::OnGrabbableGrabbed);
 		snappedGrabbable->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+		AVRHand::InvalidateInterfaceCache();
 		snappedGrabbable->grabbableMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
 		snappedGrabbable->grabbableMesh->SetSimulatePhysics(true);
 
@@ -118,6 +118,7 @@ void USnappingSlidableComponent::OverlapBegin(UPrimitiveComponent* OverlappedCom
 			// Snap grabbable to the start of the sliding mesh.
 			grabbableActor->grabbableMesh->SetSimulatePhysics(false);
 			grabbableActor->AttachToComponent(slidingMesh, FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+			AVRHand::InvalidateInterfaceCache();
 			grabbableActor->grabbableMesh->SetRelativeLocationAndRotation(locationOffset, rotationOffset);
 
 			// Bind to the snappedGrabbables grabbed function so it can be canceled and redirected to grab the slidngMesh.
@@ -201,7 +202,7 @@ void USnappingSlidableComponent::OnGrabbableGrabbed(AVRHand* hand)
 		snappedGrabbable->cancelGrab = true;
 
 		// Fix for highlighting not disabling after grabbing.
-		IInteractionInterface::Execute_EndOverlapping(snappedGrabbable, hand);
+		IInteractionInterface::Dispatch_EndOverlapping(snappedGrabbable, hand);
 
 		// Force grab on the sliding mesh instead.
 		hand->ForceGrab(slidingMesh);
@@ -223,6 +224,7 @@ void USnappingSlidableComponent::ForceSnap(AGrabbableActor* actorToSnap)
 		// Snap grabbable to the start of the sliding mesh.
 		snappedGrabbable->grabbableMesh->SetSimulatePhysics(false);
 		snappedGrabbable->AttachToComponent(slidingMesh, FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+		AVRHand::InvalidateInterfaceCache();
 		snappedGrabbable->grabbableMesh->SetRelativeLocationAndRotation(locationOffset, rotationOffset);
 
 		// Bind to the snappedGrabbables grabbed function so it can be canceled and redirected to grab the slidngMesh.
@@ -240,6 +242,7 @@ void USnappingSlidableComponent::ForceRelease()
 		// Remove delegate before re-grabbed.
 		if (snappedGrabbable->OnMeshGrabbed.Contains(this, "OnGrabbableGrabbed")) snappedGrabbable->OnMeshGrabbed.RemoveDynamic(this, &USnappingSlidableComponent::OnGrabbableGrabbed);
 		snappedGrabbable->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+		AVRHand::InvalidateInterfaceCache();
 		snappedGrabbable->grabbableMesh->SetSimulatePhysics(true);
 
 		// Remove old variable values.
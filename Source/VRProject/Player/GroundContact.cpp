@@ -0,0 +1,71 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Player/GroundContact.h"
+#include "Engine/World.h"
+
+FGroundContact::FGroundContact()
+{
+	moveThreshold = 1.0f;
+	landDistance = 1.0f;
+	releaseDistance = 3.0f;
+	airborneDelay = 0.05f;
+	walkableZ = 0.7f;
+	Reset(true);
+}
+
+void FGroundContact::Reset(bool startGrounded)
+{
+	grounded = startGrounded;
+	contact = false;
+	traced = false;
+	tracedLocation = FVector::ZeroVector;
+	airborneTime = 0.0f;
+	queryCount = 0;
+}
+
+void FGroundContact::NotifyContact(const FVector& impactNormal)
+{
+	if (impactNormal.Z >= walkableZ) contact = true;
+}
+
+bool FGroundContact::Update(UWorld* world, const FVector& feetLocation, FName profile, const FCollisionQueryParams& queryParams, float deltaTime)
+{
+	// A walkable contact from the capsule already proves there is ground, so no trace is needed.
+	if (contact)
+	{
+		contact = false;
+		grounded = true;
+		airborneTime = 0.0f;
+		traced = true;
+		tracedLocation = feetLocation;
+		return grounded;
+	}
+
+	// Keep the last result while the feet haven't moved, unless the floor is being waited on to leave the ground.
+	FVector moved = feetLocation - tracedLocation;
+	if (traced && airborneTime == 0.0f && moved.Size2D() < moveThreshold && FMath::Abs(moved.Z) < moveThreshold) return grounded;
+
+	FHitResult floorCheck;
+	float traceDistance = grounded ? releaseDistance : landDistance;
+	world->LineTraceSingleByProfile(floorCheck, feetLocation, feetLocation - FVector(0.0f, 0.0f, traceDistance), profile, queryParams);
+	queryCount++;
+	traced = true;
+	tracedLocation = feetLocation;
+
+	// Land as soon as a floor is found, but only leave the ground once the floor has been missing for the delay.
+	if (floorCheck.bBlockingHit)
+	{
+		grounded = true;
+		airborneTime = 0.0f;
+	}
+	else if (grounded)
+	{
+		airborneTime += deltaTime;
+		if (airborneTime >= airborneDelay)
+		{
+			grounded = false;
+			airborneTime = 0.0f;
+		}
+	}
+	return grounded;
+}
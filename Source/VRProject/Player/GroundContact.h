@@ -0,0 +1,58 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "CollisionQueryParams.h"
+
+/** Define classes used. */
+class UWorld;
+
+/** Tracks whether the players feet are on the ground for non-physics locomotion without tracing every frame. The floor is only traced again once the feet
+ * have moved past a threshold since the last trace, and walkable contacts reported by the capsules own physics ground the player without any trace.
+ * Leaving the ground uses a longer trace and a short delay so standing on an edge or walking over small gaps doesn't flip physics on and off.
+ * NOTE: A player that isn't moving costs no scene queries, so a floor removed from under a stationary player is only noticed once they move. */
+class VRPROJECT_API FGroundContact
+{
+public:
+
+	float moveThreshold; /** Distance in cm the feet can move horizontally or vertically before the floor is traced again. */
+	float landDistance; /** How far below the feet a floor is found while in the air. */
+	float releaseDistance; /** How far below the feet a floor is still found while grounded, longer than landDistance to avoid flipping at edges. */
+	float airborneDelay; /** Seconds the floor must be missing before leaving the ground. */
+	float walkableZ; /** Minimum up component of a contacts normal for it to count as ground. */
+
+	/** Constructor. */
+	FGroundContact();
+
+	/** Forget the last trace and any contacts, the next update always traces.
+	 * @Param startGrounded, Is the player starting on the ground. */
+	void Reset(bool startGrounded);
+
+	/** Record a contact reported by the capsules physics or movement sweeps, grounding the player on the next update if it is walkable.
+	 * @Param impactNormal, Normal of the surface touched. */
+	void NotifyContact(const FVector& impactNormal);
+
+	/** Update the ground state, tracing the floor only if needed.
+	 * @Param world, The world to trace in.
+	 * @Param feetLocation, World location of the players feet.
+	 * @Param profile, Collision profile to trace the floor with.
+	 * @Param queryParams, Query params for the floor trace.
+	 * @Param deltaTime, Seconds since the last update.
+	 * @Return true if the player is on the ground. */
+	bool Update(UWorld* world, const FVector& feetLocation, FName profile, const FCollisionQueryParams& queryParams, float deltaTime);
+
+	/** @Return true if the player is on the ground. */
+	FORCEINLINE bool IsGrounded() const { return grounded; }
+
+	/** @Return the number of floor traces issued since the last reset. */
+	FORCEINLINE int32 GetQueryCount() const { return queryCount; }
+
+private:
+
+	bool grounded; /** Is the player on the ground. */
+	bool contact; /** Has a walkable contact been reported since the last update. */
+	bool traced; /** Has the floor been traced since the last reset. */
+	FVector tracedLocation; /** Feet location of the last trace. */
+	float airborneTime; /** Seconds the floor has been missing while grounded. */
+	int32 queryCount; /** Floor traces issued since the last reset. */
+};
@@ -1,10 +1,218 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "Player/HandsAnimInstance.h"
+#include "Animation/AnimSequence.h"
 
 DEFINE_LOG_CATEGORY(LogHandAnimInst);
 
 UHandsAnimInstance::UHandsAnimInstance(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
 	handLerpSpeed = 15.0f;
-}
\ No newline at end of file
+	openHandPose = nullptr;
+	closedHandPose = nullptr;
+	fingerRootBones = { "Thumb 1", "Index 1", "Middle 1", "Ring 1", "Pinky 1" };
+	curlSteps = 32;
+}
+
+FAnimInstanceProxy* UHandsAnimInstance::CreateAnimInstanceProxy()
+{
+	return new FHandsAnimInstanceProxy(this);
+}
+
+void UHandsAnimInstance::DestroyAnimInstanceProxy(FAnimInstanceProxy* InProxy)
+{
+	delete static_cast<FHandsAnimInstanceProxy*>(InProxy);
+}
+
+/////////////////////////////////////////////////////
+/**				Hand pose table.                   */
+/////////////////////////////////////////////////////
+
+bool FHandPoseTable::IsBuiltFor(const FBoneContainer& bones) const
+{
+	return builtForAsset == bones.GetAsset() && builtForBoneCount == bones.GetCompactPoseNumBones();
+}
+
+bool FHandPoseTable::Build(const FBoneContainer& bones, const UAnimSequence* open, const UAnimSequence* closed, const FName* fingerRoots, int32 steps)
+{
+	// Mark as built for these bones even if it fails so it isn't retried every evaluation.
+	builtForAsset = bones.GetAsset();
+	builtForBoneCount = bones.GetCompactPoseNumBones();
+	curlSteps = FMath::Max(steps, 2);
+	for (int32 finger = 0; finger < HAND_FINGER_COUNT; finger++)
+	{
+		fingerBones[finger].Reset();
+		fingerPoses[finger].Reset();
+	}
+
+	// Sample the first frame of the open and closed poses.
+	FCompactPose closedPose;
+	FBlendedCurve curve;
+	openPose.SetBoneContainer(&bones);
+	closedPose.SetBoneContainer(&bones);
+	curve.InitFrom(bones);
+	open->GetAnimationPose(openPose, curve, FAnimExtractContext(0.0f));
+	closed->GetAnimationPose(closedPose, curve, FAnimExtractContext(0.0f));
+
+	// Find the root of each finger, it may have been removed by the current LOD.
+	TArray<int32> boneFinger;
+	boneFinger.Init(INDEX_NONE, builtForBoneCount);
+	for (int32 finger = 0; finger < HAND_FINGER_COUNT; finger++)
+	{
+		int32 meshIndex = bones.GetPoseBoneIndexForBoneName(fingerRoots[finger]);
+		if (meshIndex == INDEX_NONE) return false;
+		FCompactPoseBoneIndex rootIndex = bones.MakeCompactPoseIndex(FMeshPoseBoneIndex(meshIndex));
+		if (!rootIndex.IsValid()) return false;
+		boneFinger[rootIndex.GetInt()] = finger;
+	}
+
+	// Every bone beneath a finger root belongs to that finger. Parents always come before their children in a compact pose.
+	for (FCompactPoseBoneIndex index : openPose.ForEachBoneIndex())
+	{
+		if (boneFinger[index.GetInt()] == INDEX_NONE)
+		{
+			FCompactPoseBoneIndex parentIndex = bones.GetParentBoneIndex(index);
+			if (parentIndex.IsValid()) boneFinger[index.GetInt()] = boneFinger[parentIndex.GetInt()];
+		}
+		if (boneFinger[index.GetInt()] != INDEX_NONE) fingerBones[boneFinger[index.GetInt()]].Add(index);
+	}
+
+	// Blend each finger between open and closed at every curl step.
+	for (int32 finger = 0; finger < HAND_FINGER_COUNT; finger++)
+	{
+		const TArray<FCompactPoseBoneIndex>& fingerIndices = fingerBones[finger];
+		fingerPoses[finger].SetNumUninitialized(curlSteps * fingerIndices.Num());
+		for (int32 step = 0; step < curlSteps; step++)
+		{
+			float alpha = (float)step / (float)(curlSteps - 1);
+			for (int32 i = 0; i < fingerIndices.Num(); i++)
+			{
+				FTransform& stepPose = fingerPoses[finger][step * fingerIndices.Num() + i];
+				stepPose.Blend(openPose[fingerIndices[i]], closedPose[fingerIndices[i]], alpha);
+			}
+		}
+	}
+	return true;
+}
+
+void FHandPoseTable::Evaluate(const float* curls, FCompactPose& outPose) const
+{
+	// Start from the open pose for the palm and any other bones.
+	outPose.CopyBonesFrom(openPose);
+
+	// Copy each fingers bones from its nearest curl step.
+	for (int32 finger = 0; finger < HAND_FINGER_COUNT; finger++)
+	{
+		const TArray<FCompactPoseBoneIndex>& fingerIndices = fingerBones[finger];
+		int32 step = FMath::Clamp(FMath::RoundToInt(curls[finger] * (curlSteps - 1)), 0, curlSteps - 1);
+		const FTransform* stepPoses = fingerPoses[finger].GetData() + step * fingerIndices.Num();
+		for (int32 i = 0; i < fingerIndices.Num(); i++)
+		{
+			outPose[fingerIndices[i]] = stepPoses[i];
+		}
+	}
+}
+
+/////////////////////////////////////////////////////
+/**				Hands anim proxy.                  */
+/////////////////////////////////////////////////////
+
+FHandsAnimInstanceProxy::FHandsAnimInstanceProxy()
+	: FAnimInstanceProxy()
+{
+	FMemory::Memzero(closingAmounts);
+	FMemory::Memzero(lerpAmounts);
+	lerpSpeed = 15.0f;
+	openPose = nullptr;
+	closedPose = nullptr;
+	curlSteps = 32;
+	tableValid = false;
+}
+
+FHandsAnimInstanceProxy::FHandsAnimInstanceProxy(UAnimInstance* instance)
+	: FAnimInstanceProxy(instance)
+{
+	FMemory::Memzero(closingAmounts);
+	FMemory::Memzero(lerpAmounts);
+	lerpSpeed = 15.0f;
+	openPose = nullptr;
+	closedPose = nullptr;
+	curlSteps = 32;
+	tableValid = false;
+}
+
+void FHandsAnimInstanceProxy::PreUpdate(UAnimInstance* InAnimInstance, float DeltaSeconds)
+{
+	FAnimInstanceProxy::PreUpdate(InAnimInstance, DeltaSeconds);
+
+	// Copy the curls pushed by the hand this frame.
+	UHandsAnimInstance* handAnim = CastChecked<UHandsAnimInstance>(InAnimInstance);
+	closingAmounts[0] = handAnim->thumbClosingAmount;
+	closingAmounts[1] = handAnim->fingerClosingAmount;
+	closingAmounts[2] = handAnim->middleClosingAmount;
+	closingAmounts[3] = handAnim->ringClosingAmount;
+	closingAmounts[4] = handAnim->pinkyClosingAmount;
+	lerpSpeed = handAnim->handLerpSpeed;
+
+	// Copy the pose table settings, forcing a rebuild if they have changed.
+	bool rootsValid = handAnim->fingerRootBones.Num() == HAND_FINGER_COUNT;
+	const UAnimSequence* newOpenPose = rootsValid ? handAnim->openHandPose : nullptr;
+	const UAnimSequence* newClosedPose = rootsValid ? handAnim->closedHandPose : nullptr;
+	if (newOpenPose != openPose || newClosedPose != closedPose || handAnim->curlSteps != curlSteps)
+	{
+		openPose = newOpenPose;
+		closedPose = newClosedPose;
+		curlSteps = handAnim->curlSteps;
+		poseTable = FHandPoseTable();
+		tableValid = false;
+	}
+	if (rootsValid)
+	{
+		for (int32 finger = 0; finger < HAND_FINGER_COUNT; finger++)
+		{
+			fingerRootBones[finger] = handAnim->fingerRootBones[finger];
+		}
+	}
+}
+
+void FHandsAnimInstanceProxy::Update(float DeltaSeconds)
+{
+	FAnimInstanceProxy::Update(DeltaSeconds);
+
+	// Ease each finger towards its curl.
+	for (int32 finger = 0; finger < HAND_FINGER_COUNT; finger++)
+	{
+		lerpAmounts[finger] = FMath::FInterpTo(lerpAmounts[finger], closingAmounts[finger], DeltaSeconds, lerpSpeed);
+	}
+}
+
+void FHandsAnimInstanceProxy::PostUpdate(UAnimInstance* InAnimInstance) const
+{
+	FAnimInstanceProxy::PostUpdate(InAnimInstance);
+
+	// Expose the eased curls to blueprints.
+	UHandsAnimInstance* handAnim = CastChecked<UHandsAnimInstance>(InAnimInstance);
+	handAnim->thumbLerpAmount = lerpAmounts[0];
+	handAnim->fingerLerpingAmount = lerpAmounts[1];
+	handAnim->middleLerpAmount = lerpAmounts[2];
+	handAnim->ringLerpAmount = lerpAmounts[3];
+	handAnim->pinkyLerpAmount = lerpAmounts[4];
+}
+
+bool FHandsAnimInstanceProxy::Evaluate(FPoseContext& Output)
+{
+	// Use the anim graph if there are no poses to build the table from.
+	if (!openPose || !closedPose) return false;
+
+	// Rebuild the table whenever the required bones change.
+	const FBoneContainer& bones = Output.Pose.GetBoneContainer();
+	if (!poseTable.IsBuiltFor(bones))
+	{
+		tableValid = poseTable.Build(bones, openPose, closedPose, fingerRootBones, curlSteps);
+		if (!tableValid) UE_LOG(LogHandAnimInst, Warning, TEXT("Could not build the hand pose table for %s, falling back to the anim graph. Check the finger root bones exist."), *GetNameSafe(GetSkelMeshComponent()));
+	}
+	if (!tableValid) return false;
+
+	poseTable.Evaluate(lerpAmounts, Output.Pose);
+	return true;
+}
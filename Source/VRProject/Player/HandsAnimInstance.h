@@ -4,13 +4,93 @@
 
 #include "CoreMinimal.h"
 #include "Animation/AnimInstance.h"
+#include "Animation/AnimInstanceProxy.h"
 #include "Globals.h"
 #include "HandsAnimInstance.generated.h"
 
 /** Define this actors log category. */
 DECLARE_LOG_CATEGORY_EXTERN(LogHandAnimInst, Log, All);
 
-/** This is set as the parent of the animation blueprint so I can communicate these variables from C++ into that animation blueprint. */
+/** Define classes used. */
+class UAnimSequence;
+
+/** Number of fingers driven by the hand animation. Ordered thumb, index, middle, ring, pinky. */
+#define HAND_FINGER_COUNT 5
+
+/** Precomputed local bone poses for each finger at evenly spaced curl values between an open and closed hand pose.
+ * NOTE: Built for a specific bone container, so rebuilt when the required bones change e.g. on an LOD change. */
+struct FHandPoseTable
+{
+	FCompactPose openPose; /** The open hand pose, used for every bone that isn't part of a finger. */
+	TArray<FCompactPoseBoneIndex> fingerBones[HAND_FINGER_COUNT]; /** Compact pose indices of the bones in each finger. */
+	TArray<FTransform> fingerPoses[HAND_FINGER_COUNT]; /** Local bone transforms of each finger laid out by curl step then finger bone. */
+	int32 curlSteps; /** Number of curl values stored per finger. */
+	const UObject* builtForAsset; /** The skeletal mesh/skeleton the table was built for. */
+	int32 builtForBoneCount; /** Compact bone count the table was built for. */
+
+	/** Constructor. */
+	FHandPoseTable()
+		: curlSteps(0)
+		, builtForAsset(nullptr)
+		, builtForBoneCount(0)
+	{}
+
+	/** @Return true if the table has been built for the given bone container. */
+	bool IsBuiltFor(const FBoneContainer& bones) const;
+
+	/** Build the table by sampling the open and closed poses and blending each finger between them.
+	 * @Param bones, The required bones to build the table for.
+	 * @Param open, Animation of the hand fully open.
+	 * @Param closed, Animation of the hand fully closed.
+	 * @Param fingerRoots, The root bone of each finger, every bone under a root is driven by that fingers curl.
+	 * @Param steps, Number of curl values to store per finger.
+	 * @Return true if every finger root was found and the table can be used. */
+	bool Build(const FBoneContainer& bones, const UAnimSequence* open, const UAnimSequence* closed, const FName* fingerRoots, int32 steps);
+
+	/** Write the pose for the given finger curls.
+	 * @Param curls, Curl of each finger from 0 (open) to 1 (closed).
+	 * @Param outPose, The pose to write, must use the bone container the table was built for. */
+	void Evaluate(const float* curls, FCompactPose& outPose) const;
+};
+
+/** Animation proxy for the hands. Eases the finger curls and builds the hand pose from the pose table on worker threads. */
+USTRUCT()
+struct VRPROJECT_API FHandsAnimInstanceProxy : public FAnimInstanceProxy
+{
+	GENERATED_BODY()
+
+	/** Constructors. */
+	FHandsAnimInstanceProxy();
+	FHandsAnimInstanceProxy(UAnimInstance* instance);
+
+	/** Copy the finger curls and settings from the anim instance. Game thread. */
+	virtual void PreUpdate(UAnimInstance* InAnimInstance, float DeltaSeconds) override;
+
+	/** Ease the fingers towards their curls. Worker thread. */
+	virtual void Update(float DeltaSeconds) override;
+
+	/** Copy the eased finger curls back to the anim instance. Game thread. */
+	virtual void PostUpdate(UAnimInstance* InAnimInstance) const override;
+
+	/** Build the pose from the pose table. Falls back to the anim graph if the table cannot be used. Worker thread. */
+	virtual bool Evaluate(FPoseContext& Output) override;
+
+private:
+
+	float closingAmounts[HAND_FINGER_COUNT]; /** Target curl of each finger from the hand. */
+	float lerpAmounts[HAND_FINGER_COUNT]; /** Eased curl of each finger. */
+	float lerpSpeed; /** Speed the fingers ease towards their target curls. */
+	const UAnimSequence* openPose; /** Animation of the hand fully open. */
+	const UAnimSequence* closedPose; /** Animation of the hand fully closed. */
+	FName fingerRootBones[HAND_FINGER_COUNT]; /** The root bone of each finger. */
+	int32 curlSteps; /** Curl values stored per finger in the pose table. */
+	bool tableValid; /** The pose table was built and found every finger. */
+	FHandPoseTable poseTable; /** Precomputed finger poses. */
+};
+
+/** This is set as the parent of the animation blueprint so I can communicate these variables from C++ into that animation blueprint.
+ * NOTE: When the open and closed hand poses are set the pose is built natively from a lookup table on worker threads and the anim graph is skipped.
+ *		 Enable "Use Multi Threaded Animation Update" on the anim blueprint and leave its event graph empty to keep the whole update off the game thread. */
 UCLASS(transient, Blueprintable, hideCategories = AnimInstance, BlueprintType)
 class VRPROJECT_API UHandsAnimInstance : public UAnimInstance
 {
@@ -61,4 +141,28 @@ public:
 	/*** Speed to lerp in between animation states. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Hands)
 	float handLerpSpeed;
+
+	/** Animation of the hand fully open. Sampled at its first frame into the pose table. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Hands|PoseTable")
+	UAnimSequence* openHandPose;
+
+	/** Animation of the hand fully closed. Sampled at its first frame into the pose table. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Hands|PoseTable")
+	UAnimSequence* closedHandPose;
+
+	/** Root bone of each finger, every bone beneath it is driven by that fingers curl. Ordered thumb, index, middle, ring, pinky. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Hands|PoseTable")
+	TArray<FName> fingerRootBones;
+
+	/** Number of curl values precomputed per finger. Curls are quantized to the nearest step. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Hands|PoseTable", meta = (ClampMin = "2", ClampMax = "256"))
+	int32 curlSteps;
+
+protected:
+
+	/** Create the native proxy that updates and evaluates the hand on worker threads. */
+	virtual FAnimInstanceProxy* CreateAnimInstanceProxy() override;
+
+	/** Destroy the native proxy. */
+	virtual void DestroyAnimInstanceProxy(FAnimInstanceProxy* InProxy) override;
 };
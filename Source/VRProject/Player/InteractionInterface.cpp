@@ -3,10 +3,224 @@
 #include "Player/InteractionInterface.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/ShapeComponent.h"
+#include "UObject/ObjectKey.h"
 #include "VRHand.h"
 
 DEFINE_LOG_CATEGORY(LogInteractionInterface);
 
+/** Information for each class that has been checked against this interface. Keyed by object key so unloaded classes are never dereferenced. */
+static TMap<FObjectKey, FInteractionClassInfo> interactionClassInfo;
+
+/** How an interface event should be called on an object. */
+enum class EInteractionDispatch : uint8
+{
+	Skip,
+	Native,
+	Blueprint
+};
+
+/** Find how to call the given event on the object.
+ * @Param object, The object implementing the interface.
+ * @Param interactionEvent, The event being called.
+ * @Param nativeInterface, Set to the objects native interface when the event should be called directly. */
+static EInteractionDispatch GetDispatchMode(UObject* object, EInteractionEvents interactionEvent, IInteractionInterface*& nativeInterface)
+{
+	nativeInterface = nullptr;
+	if (!object) return EInteractionDispatch::Skip;
+
+	// Blueprint overrides must be called through ProcessEvent.
+	const FInteractionClassInfo& classInfo = IInteractionInterface::GetClassInfo(object->GetClass());
+	if (!EnumHasAnyFlags(classInfo.flags, EInteractionClassFlags::ImplementsInterface)) return EInteractionDispatch::Skip;
+	if (EnumHasAnyFlags(classInfo.blueprintEvents, interactionEvent)) return EInteractionDispatch::Blueprint;
+
+	// Call the implementation directly if the class handles the event natively, otherwise there is nothing to call.
+	if (EnumHasAnyFlags(classInfo.flags, EInteractionClassFlags::NativeInterface) && EnumHasAnyFlags(classInfo.nativeEvents, interactionEvent))
+	{
+		nativeInterface = (IInteractionInterface*)object->GetNativeInterfaceAddress(UInteractionInterface::StaticClass());
+		if (nativeInterface) return EInteractionDispatch::Native;
+	}
+	return EInteractionDispatch::Skip;
+}
+
+const FInteractionClassInfo& IInteractionInterface::GetClassInfo(const UClass* objectClass)
+{
+	static const FInteractionClassInfo emptyInfo;
+	if (!objectClass) return emptyInfo;
+
+	// Return the cached information if this class has been checked before.
+	FObjectKey classKey(objectClass);
+	if (FInteractionClassInfo* cachedInfo = interactionClassInfo.Find(classKey)) return *cachedInfo;
+
+	// Otherwise resolve the information using reflection and save it for the next time this class is checked.
+	FInteractionClassInfo newInfo;
+	if (objectClass->ImplementsInterface(UInteractionInterface::StaticClass()))
+	{
+		newInfo.flags |= EInteractionClassFlags::ImplementsInterface;
+
+		// If the interface is implemented in C++ get the events handled by the native implementation from the class default object.
+		UObject* defaultObject = const_cast<UClass*>(objectClass)->GetDefaultObject();
+		if (IInteractionInterface* nativeInterface = (IInteractionInterface*)defaultObject->GetNativeInterfaceAddress(UInteractionInterface::StaticClass()))
+		{
+			newInfo.flags |= EInteractionClassFlags::NativeInterface;
+			const UClass* derivedFor = nullptr;
+			newInfo.nativeEvents = nativeInterface->GetHandledInteractionEvents(derivedFor);
+
+			// Events inherited from a native parent may miss functions the nearest native class overrides, so dispatch everything to it instead.
+			const UClass* nativeClass = objectClass;
+			while (nativeClass && !nativeClass->HasAnyClassFlags(CLASS_Native)) nativeClass = nativeClass->GetSuperClass();
+			if (derivedFor && derivedFor != nativeClass)
+			{
+				ensureMsgf(false, TEXT("%s implements the interaction interface without INTERACTION_EVENTS_BODY, every event will be dispatched to it."), *GetNameSafe(nativeClass));
+				newInfo.nativeEvents = EInteractionEvents::All;
+			}
+		}
+
+		// Any event function that isn't native has been overridden in blueprint.
+		struct FEventFunction { FName name; EInteractionEvents interactionEvent; };
+		static const FEventFunction eventFunctions[] = {
+			{ FName("Grabbed"), EInteractionEvents::Grabbed },
+			{ FName("Released"), EInteractionEvents::Released },
+			{ FName("Squeezing"), EInteractionEvents::Squeezing },
+			{ FName("Dragging"), EInteractionEvents::Dragging },
+			{ FName("Interact"), EInteractionEvents::Interact },
+			{ FName("Overlapping"), EInteractionEvents::Overlapping },
+			{ FName("EndOverlapping"), EInteractionEvents::EndOverlapping },
+			{ FName("Teleported"), EInteractionEvents::Teleported },
+			{ FName("GetInterfaceSettings"), EInteractionEvents::GetInterfaceSettings },
+			{ FName("SetInterfaceSettings"), EInteractionEvents::SetInterfaceSettings }
+		};
+		for (const FEventFunction& eventFunction : eventFunctions)
+		{
+			UFunction* foundFunction = objectClass->FindFunctionByName(eventFunction.name);
+			if (foundFunction && !foundFunction->HasAnyFunctionFlags(FUNC_Native)) newInfo.blueprintEvents |= eventFunction.interactionEvent;
+		}
+	}
+	return interactionClassInfo.Add(classKey, newInfo);
+}
+
+EInteractionClassFlags IInteractionInterface::GetClassFlags(const UClass* objectClass)
+{
+	return GetClassInfo(objectClass).flags;
+}
+
+bool IInteractionInterface::ClassImplementsInterface(const UClass* objectClass)
+{
+	return EnumHasAnyFlags(GetClassFlags(objectClass), EInteractionClassFlags::ImplementsInterface);
+}
+
+void IInteractionInterface::Dispatch_Grabbed(UObject* object, AVRHand* hand)
+{
+	IInteractionInterface* nativeInterface;
+	switch (GetDispatchMode(object, EInteractionEvents::Grabbed, nativeInterface))
+	{
+	case EInteractionDispatch::Native: nativeInterface->Grabbed_Implementation(hand); break;
+	case EInteractionDispatch::Blueprint: Execute_Grabbed(object, hand); break;
+	default: break;
+	}
+}
+
+void IInteractionInterface::Dispatch_Released(UObject* object, AVRHand* hand)
+{
+	IInteractionInterface* nativeInterface;
+	switch (GetDispatchMode(object, EInteractionEvents::Released, nativeInterface))
+	{
+	case EInteractionDispatch::Native: nativeInterface->Released_Implementation(hand); break;
+	case EInteractionDispatch::Blueprint: Execute_Released(object, hand); break;
+	default: break;
+	}
+}
+
+void IInteractionInterface::Dispatch_Squeezing(UObject* object, AVRHand* hand, float howHard)
+{
+	IInteractionInterface* nativeInterface;
+	switch (GetDispatchMode(object, EInteractionEvents::Squeezing, nativeInterface))
+	{
+	case EInteractionDispatch::Native: nativeInterface->Squeezing_Implementation(hand, howHard); break;
+	case EInteractionDispatch::Blueprint: Execute_Squeezing(object, hand, howHard); break;
+	default: break;
+	}
+}
+
+void IInteractionInterface::Dispatch_Dragging(UObject* object, float deltaTime)
+{
+	IInteractionInterface* nativeInterface;
+	switch (GetDispatchMode(object, EInteractionEvents::Dragging, nativeInterface))
+	{
+	case EInteractionDispatch::Native: nativeInterface->Dragging_Implementation(deltaTime); break;
+	case EInteractionDispatch::Blueprint: Execute_Dragging(object, deltaTime); break;
+	default: break;
+	}
+}
+
+void IInteractionInterface::Dispatch_Interact(UObject* object, bool pressed)
+{
+	IInteractionInterface* nativeInterface;
+	switch (GetDispatchMode(object, EInteractionEvents::Interact, nativeInterface))
+	{
+	case EInteractionDispatch::Native: nativeInterface->Interact_Implementation(pressed); break;
+	case EInteractionDispatch::Blueprint: Execute_Interact(object, pressed); break;
+	default: break;
+	}
+}
+
+void IInteractionInterface::Dispatch_Overlapping(UObject* object, AVRHand* hand)
+{
+	IInteractionInterface* nativeInterface;
+	switch (GetDispatchMode(object, EInteractionEvents::Overlapping, nativeInterface))
+	{
+	case EInteractionDispatch::Native: nativeInterface->Overlapping_Implementation(hand); break;
+	case EInteractionDispatch::Blueprint: Execute_Overlapping(object, hand); break;
+	default: break;
+	}
+}
+
+void IInteractionInterface::Dispatch_EndOverlapping(UObject* object, AVRHand* hand)
+{
+	IInteractionInterface* nativeInterface;
+	switch (GetDispatchMode(object, EInteractionEvents::EndOverlapping, nativeInterface))
+	{
+	case EInteractionDispatch::Native: nativeInterface->EndOverlapping_Implementation(hand); break;
+	case EInteractionDispatch::Blueprint: Execute_EndOverlapping(object, hand); break;
+	default: break;
+	}
+}
+
+void IInteractionInterface::Dispatch_Teleported(UObject* object)
+{
+	IInteractionInterface* nativeInterface;
+	switch (GetDispatchMode(object, EInteractionEvents::Teleported, nativeInterface))
+	{
+	case EInteractionDispatch::Native: nativeInterface->Teleported_Implementation(); break;
+	case EInteractionDispatch::Blueprint: Execute_Teleported(object); break;
+	default: break;
+	}
+}
+
+FInterfaceSettings IInteractionInterface::Dispatch_GetInterfaceSettings(UObject* object)
+{
+	// Settings are always returned, so fall back to the execute function if there is no native implementation.
+	IInteractionInterface* nativeInterface;
+	if (GetDispatchMode(object, EInteractionEvents::GetInterfaceSettings, nativeInterface) == EInteractionDispatch::Native) return nativeInterface->GetInterfaceSettings_Implementation();
+	return Execute_GetInterfaceSettings(object);
+}
+
+void IInteractionInterface::Dispatch_SetInterfaceSettings(UObject* object, FInterfaceSettings newInterfaceSettings)
+{
+	IInteractionInterface* nativeInterface;
+	switch (GetDispatchMode(object, EInteractionEvents::SetInterfaceSettings, nativeInterface))
+	{
+	case EInteractionDispatch::Native: nativeInterface->SetInterfaceSettings_Implementation(newInterfaceSettings); break;
+	case EInteractionDispatch::Blueprint: Execute_SetInterfaceSettings(object, newInterfaceSettings); break;
+	default: break;
+	}
+}
+
+EInteractionEvents IInteractionInterface::GetHandledInteractionEvents(const UClass*& outDerivedFor) const
+{
+	outDerivedFor = nullptr;
+	return EInteractionEvents::All;
+}
+
 void IInteractionInterface::Grabbed_Implementation(AVRHand* hand)
 {
 
@@ -31,7 +245,7 @@ void IInteractionInterface::Overlapping_Implementation(AVRHand* hand)
 {
 	// Get the interfaces settings.
 	UObject* objectClass = _getUObject();
-	FInterfaceSettings currentSettings = IInteractionInterface::Execute_GetInterfaceSettings(objectClass);
+	FInterfaceSettings currentSettings = IInteractionInterface::Dispatch_GetInterfaceSettings(objectClass);
 
 	// Add the overlapped hand.
 	overlappingHands.Add(hand);
@@ -89,7 +303,7 @@ void IInteractionInterface::EndOverlapping_Implementation(AVRHand* hand)
 {
 	// Get the interfaces settings.
 	UObject* objectClass = _getUObject();
-	FInterfaceSettings currentSettings = IInteractionInterface::Execute_GetInterfaceSettings(objectClass);
+	FInterfaceSettings currentSettings = IInteractionInterface::Dispatch_GetInterfaceSettings(objectClass);
 
 	// Remove the overlapped hand.
 	overlappingHands.Remove(hand);
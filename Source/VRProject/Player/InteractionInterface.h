@@ -77,6 +77,50 @@ public:
 	}
 };
 
+/** Cached reflection results for classes checked against the interaction interface. Resolved once per UClass. */
+enum class EInteractionClassFlags : uint8
+{
+	None = 0,
+	ImplementsInterface = 1 << 0,
+	NativeInterface = 1 << 1 /** The interface is implemented in C++ so the _Implementation functions can be called directly. */
+};
+ENUM_CLASS_FLAGS(EInteractionClassFlags);
+
+/** Interface events, used to flag which events a class handles so the dispatch functions can skip empty handlers. */
+enum class EInteractionEvents : uint16
+{
+	None = 0,
+	Grabbed = 1 << 0,
+	Released = 1 << 1,
+	Squeezing = 1 << 2,
+	Dragging = 1 << 3,
+	Interact = 1 << 4,
+	Overlapping = 1 << 5,
+	EndOverlapping = 1 << 6,
+	Teleported = 1 << 7,
+	GetInterfaceSettings = 1 << 8,
+	SetInterfaceSettings = 1 << 9,
+	All = 0x3FF
+};
+ENUM_CLASS_FLAGS(EInteractionEvents);
+
+/** Declare the events handled by a native class implementing the interaction interface, derived from which _Implementation functions the class overrides.
+ * NOTE: Add to the public section of every native class that implements or overrides the interfaces functions, native subclasses without it dispatch every event. */
+#define INTERACTION_EVENTS_BODY(ClassName) \
+	virtual EInteractionEvents GetHandledInteractionEvents(const UClass*& outDerivedFor) const override \
+	{ \
+		outDerivedFor = ClassName::StaticClass(); \
+		return IInteractionInterface::DeriveHandledInteractionEvents<ClassName>(); \
+	}
+
+/** Cached information about a class checked against the interaction interface. */
+struct FInteractionClassInfo
+{
+	EInteractionClassFlags flags = EInteractionClassFlags::None;
+	EInteractionEvents nativeEvents = EInteractionEvents::None; /** Events handled by the classes C++ implementation. */
+	EInteractionEvents blueprintEvents = EInteractionEvents::None; /** Events overridden in blueprint, these must be called through ProcessEvent. */
+};
+
 //=================================
 // Interface
 //=================================
@@ -127,6 +171,40 @@ public:
  	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = Hands)
  	void SetInterfaceSettings(FInterfaceSettings newInterfaceSettings);
 
+	/** Get the cached interaction information for a class. Reflection is only used the first time a class is checked.
+	 * @Param objectClass, The class to get the information of. */
+	static const FInteractionClassInfo& GetClassInfo(const UClass* objectClass);
+
+	/** Get the cached interaction flags for a class.
+	 * @Param objectClass, The class to get the flags of. */
+	static EInteractionClassFlags GetClassFlags(const UClass* objectClass);
+
+	/** @Return true if the given class implements this interface. Uses the cached class flags instead of reflection. */
+	static bool ClassImplementsInterface(const UClass* objectClass);
+
+	/** Dispatch functions to use instead of the Execute functions. Calls the _Implementation functions directly on classes without a blueprint override,
+	 * only uses ProcessEvent for blueprint implementations and skips the call entirely if the class doesn't handle the event. */
+	static void Dispatch_Grabbed(UObject* object, AVRHand* hand);
+	static void Dispatch_Released(UObject* object, AVRHand* hand);
+	static void Dispatch_Squeezing(UObject* object, AVRHand* hand, float howHard);
+	static void Dispatch_Dragging(UObject* object, float deltaTime);
+	static void Dispatch_Interact(UObject* object, bool pressed);
+	static void Dispatch_Overlapping(UObject* object, AVRHand* hand);
+	static void Dispatch_EndOverlapping(UObject* object, AVRHand* hand);
+	static void Dispatch_Teleported(UObject* object);
+	static FInterfaceSettings Dispatch_GetInterfaceSettings(UObject* object);
+	static void Dispatch_SetInterfaceSettings(UObject* object, FInterfaceSettings newInterfaceSettings);
+
+	/** The events that are handled by this classes C++ implementation. Events not returned are skipped by the dispatch functions unless overridden in blueprint.
+	 * @Param outDerivedFor, Set to the class the events were derived for, null if they weren't derived.
+	 * NOTE: Defaults to all events, use INTERACTION_EVENTS_BODY to derive them instead of overriding this by hand. */
+	virtual EInteractionEvents GetHandledInteractionEvents(const UClass*& outDerivedFor) const;
+
+	/** @Return the events a class handles. An empty event is handled if the class or one of its parents overrides its _Implementation function,
+	 * the highlighting and settings events are always handled as the interface implements them itself. */
+	template<typename ClassType>
+	static EInteractionEvents DeriveHandledInteractionEvents();
+
 	/** Setup functions for other classes overriding this interfaces functions */
 
 	/** Ran when trigger is pressed all the way down. */
@@ -159,3 +237,17 @@ public:
 	virtual FInterfaceSettings GetInterfaceSettings_Implementation();
  	virtual void SetInterfaceSettings_Implementation(FInterfaceSettings newInterfaceSettings);
 };
+
+template<typename ClassType>
+EInteractionEvents IInteractionInterface::DeriveHandledInteractionEvents()
+{
+	// The member pointers type names the class that declares the function, which is only the interface if nothing has overridden it.
+	EInteractionEvents events = EInteractionEvents::Overlapping | EInteractionEvents::EndOverlapping | EInteractionEvents::GetInterfaceSettings | EInteractionEvents::SetInterfaceSettings;
+	if (!TIsSame<decltype(&ClassType::Grabbed_Implementation), decltype(&IInteractionInterface::Grabbed_Implementation)>::Value) events |= EInteractionEvents::Grabbed;
+	if (!TIsSame<decltype(&ClassType::Released_Implementation), decltype(&IInteractionInterface::Released_Implementation)>::Value) events |= EInteractionEvents::Released;
+	if (!TIsSame<decltype(&ClassType::Squeezing_Implementation), decltype(&IInteractionInterface::Squeezing_Implementation)>::Value) events |= EInteractionEvents::Squeezing;
+	if (!TIsSame<decltype(&ClassType::Dragging_Implementation), decltype(&IInteractionInterface::Dragging_Implementation)>::Value) events |= EInteractionEvents::Dragging;
+	if (!TIsSame<decltype(&ClassType::Interact_Implementation), decltype(&IInteractionInterface::Interact_Implementation)>::Value) events |= EInteractionEvents::Interact;
+	if (!TIsSame<decltype(&ClassType::Teleported_Implementation), decltype(&IInteractionInterface::Teleported_Implementation)>::Value) events |= EInteractionEvents::Teleported;
+	return events;
+}
@@ -0,0 +1,204 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Player/TeleportArc.h"
+#include "Engine/World.h"
+#include "WorldCollision.h"
+
+FTeleportArc::FTeleportArc()
+{
+	simFrequency = 30.0f;
+	maxSimTime = 2.0f;
+	blockSize = 8;
+	coherentDistance = 20.0f;
+	coherentAngle = 5.0f;
+	arcStart = FVector::ZeroVector;
+	arcVelocity = FVector::ZeroVector;
+	arcGravity = 0.0f;
+	endTime = 0.0f;
+	endLocation = FVector::ZeroVector;
+	hasHit = false;
+	queryCount = 0;
+	pendingStart = FVector::ZeroVector;
+	pendingVelocity = FVector::ZeroVector;
+	pendingGravity = 0.0f;
+	Reset();
+}
+
+bool FTeleportArc::Trace(UWorld* world, const FVector& start, const FVector& launchVelocity, float gravityZ, ECollisionChannel channel, const FCollisionQueryParams& queryParams)
+{
+	arcStart = start;
+	arcVelocity = launchVelocity;
+	arcGravity = gravityZ;
+	hasHit = false;
+	queryCount = 0;
+	int32 totalSteps = FMath::Max(FMath::CeilToInt(maxSimTime * simFrequency - KINDA_SMALL_NUMBER), 1);
+
+	// If the aim has barely moved the arc before last traces hit segment is likely still clear, so check it with one overlap and start tracing from that segment.
+	int32 firstStep = 0;
+	if (lastHitStep != INDEX_NONE && lastHitStep < totalSteps && IsCoherent(start, launchVelocity, gravityZ))
+	{
+		if (lastHitStep == 0 || IsRangeClear(world, 0, lastHitStep, channel, queryParams)) firstStep = lastHitStep;
+	}
+
+	// Save this arc to compare against next trace.
+	lastStart = start;
+	lastVelocity = launchVelocity;
+	lastGravity = gravityZ;
+	lastHitStep = INDEX_NONE;
+
+	// Trace the rest of the arc in blocks, only tracing each segment in a block if something is inside its bounds.
+	for (int32 blockStart = firstStep; blockStart < totalSteps; blockStart += blockSize)
+	{
+		int32 blockEnd = FMath::Min(blockStart + FMath::Max(blockSize, 1), totalSteps);
+		if (blockEnd - blockStart > 1 && IsRangeClear(world, blockStart, blockEnd, channel, queryParams)) continue;
+		for (int32 step = blockStart; step < blockEnd; step++)
+		{
+			if (TraceStep(world, step, channel, queryParams))
+			{
+				lastHitStep = step;
+				return true;
+			}
+		}
+	}
+
+	// Nothing was hit so the arc runs for the full sim time.
+	endTime = maxSimTime;
+	endLocation = GetLocationAtTime(endTime);
+	return false;
+}
+
+void FTeleportArc::TraceAsync(UWorld* world, const FVector& start, const FVector& launchVelocity, float gravityZ, ECollisionChannel channel, const FCollisionQueryParams& queryParams)
+{
+	pendingStart = start;
+	pendingVelocity = launchVelocity;
+	pendingGravity = gravityZ;
+	pendingTraces.Reset();
+
+	// Queue every step, the first blocking one is found once they have all been traced.
+	int32 totalSteps = FMath::Max(FMath::CeilToInt(maxSimTime * simFrequency - KINDA_SMALL_NUMBER), 1);
+	for (int32 step = 0; step < totalSteps; step++)
+	{
+		FVector stepStart = pendingStart + pendingVelocity * GetStepTime(step) + FVector(0.0f, 0.0f, 0.5f * pendingGravity * FMath::Square(GetStepTime(step)));
+		FVector stepEnd = pendingStart + pendingVelocity * GetStepTime(step + 1) + FVector(0.0f, 0.0f, 0.5f * pendingGravity * FMath::Square(GetStepTime(step + 1)));
+		pendingTraces.Add(world->AsyncLineTraceByChannel(EAsyncTraceType::Single, stepStart, stepEnd, channel, queryParams));
+	}
+}
+
+bool FTeleportArc::ResolveAsync(UWorld* world)
+{
+	if (pendingTraces.Num() == 0) return false;
+
+	// Find the first step that hit, giving up if the results have already been discarded.
+	FTraceDatum datum;
+	int32 hitStep = INDEX_NONE;
+	for (int32 step = 0; step < pendingTraces.Num() && hitStep == INDEX_NONE; step++)
+	{
+		if (!world->QueryTraceData(pendingTraces[step], datum))
+		{
+			pendingTraces.Reset();
+			return false;
+		}
+		if (datum.OutHits.Num() > 0 && datum.OutHits[0].bBlockingHit)
+		{
+			hitStep = step;
+			hit = datum.OutHits[0];
+		}
+	}
+
+	// Make the queued arc the current one.
+	arcStart = pendingStart;
+	arcVelocity = pendingVelocity;
+	arcGravity = pendingGravity;
+	queryCount = pendingTraces.Num();
+	pendingTraces.Reset();
+	hasHit = hitStep != INDEX_NONE;
+	if (hasHit)
+	{
+		endTime = FMath::Lerp(GetStepTime(hitStep), GetStepTime(hitStep + 1), hit.Time);
+		endLocation = hit.Location;
+	}
+	else
+	{
+		endTime = maxSimTime;
+		endLocation = GetLocationAtTime(endTime);
+	}
+	return true;
+}
+
+void FTeleportArc::Reset()
+{
+	lastHitStep = INDEX_NONE;
+	lastStart = FVector::ZeroVector;
+	lastVelocity = FVector::ZeroVector;
+	lastGravity = 0.0f;
+}
+
+int32 FTeleportArc::GetStepCount() const
+{
+	return FMath::Max(FMath::CeilToInt(endTime * simFrequency - KINDA_SMALL_NUMBER), 1);
+}
+
+void FTeleportArc::Sample(const FVector& viewLocation, float errorAngle, int32 maxSegments, TArray<FVector>& outPoints, TArray<FVector>& outDirections) const
+{
+	outPoints.Reset();
+	outDirections.Reset();
+	maxSegments = FMath::Max(maxSegments, 1);
+
+	// No segment can be shorter than an even split of the cap, so the cap is never exceeded.
+	float minStepTime = endTime / maxSegments;
+	float errorTangent = FMath::Tan(FMath::DegreesToRadians(FMath::Max(errorAngle, KINDA_SMALL_NUMBER)));
+	float time = 0.0f;
+	while (time < endTime - KINDA_SMALL_NUMBER)
+	{
+		FVector location = GetLocationAtTime(time);
+		FVector velocity = GetVelocityAtTime(time);
+		outPoints.Add(location);
+		outDirections.Add(velocity);
+
+		// A chord over time t strays at most bend * t^2 / 8 from the curve, where bend is gravity across the direction of travel.
+		// Solve for the longest step that keeps that within the error angle at this distance from the viewer.
+		float bend = FMath::Abs(arcGravity) * FVector::CrossProduct(velocity.GetSafeNormal(), FVector::UpVector).Size();
+		float allowedError = errorTangent * FMath::Max(FVector::Dist(viewLocation, location), 10.0f);
+		float stepTime = bend > KINDA_SMALL_NUMBER ? FMath::Sqrt(8.0f * allowedError / bend) : endTime;
+		time += FMath::Max(stepTime, minStepTime);
+	}
+
+	// Always finish on the end of the arc.
+	outPoints.Add(endLocation);
+	outDirections.Add(GetVelocityAtTime(endTime));
+}
+
+bool FTeleportArc::IsCoherent(const FVector& start, const FVector& launchVelocity, float gravityZ) const
+{
+	if (gravityZ != lastGravity) return false;
+	if (FVector::DistSquared(start, lastStart) > FMath::Square(coherentDistance)) return false;
+	if (!FMath::IsNearlyEqual(launchVelocity.SizeSquared(), lastVelocity.SizeSquared(), KINDA_SMALL_NUMBER * lastVelocity.SizeSquared())) return false;
+	return (launchVelocity.GetSafeNormal() | lastVelocity.GetSafeNormal()) >= FMath::Cos(FMath::DegreesToRadians(coherentAngle));
+}
+
+bool FTeleportArc::IsRangeClear(UWorld* world, int32 firstStep, int32 lastStep, ECollisionChannel channel, const FCollisionQueryParams& queryParams)
+{
+	// Every segment lies inside the bounds of the points between the steps, so if nothing overlaps the bounds no segment can hit.
+	FBox bounds(ForceInit);
+	for (int32 step = firstStep; step <= lastStep; step++)
+	{
+		bounds += GetLocationAtTime(GetStepTime(step));
+	}
+	bounds = bounds.ExpandBy(1.0f);
+	queryCount++;
+	return !world->OverlapAnyTestByChannel(bounds.GetCenter(), FQuat::Identity, channel, FCollisionShape::MakeBox(bounds.GetExtent()), queryParams);
+}
+
+bool FTeleportArc::TraceStep(UWorld* world, int32 step, ECollisionChannel channel, const FCollisionQueryParams& queryParams)
+{
+	float stepStartTime = GetStepTime(step);
+	float stepEndTime = GetStepTime(step + 1);
+	queryCount++;
+	if (!world->LineTraceSingleByChannel(hit, GetLocationAtTime(stepStartTime), GetLocationAtTime(stepEndTime), channel, queryParams)) return false;
+
+	// End the arc where the segment was blocked.
+	hasHit = true;
+	endTime = FMath::Lerp(stepStartTime, stepEndTime, hit.Time);
+	endLocation = hit.Location;
+	return true;
+}
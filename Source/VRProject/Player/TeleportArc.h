@@ -0,0 +1,130 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+#include "CollisionQueryParams.h"
+#include "WorldCollision.h"
+
+/** Define classes used. */
+class UWorld;
+
+/** Traces a ballistic arc as a series of line segments, stopping at the first blocking hit. The arc is evaluated analytically so any point and tangent along it
+ * can be read without storing the path. Runs of segments are skipped with a single overlap of their bounds when nothing is inside them, and when the aim
+ * has barely changed since the last trace the arc leading up to last traces hit segment is tested first so usually only a couple of queries are needed.
+ * NOTE: The skipping is conservative, the hit found is always the same as tracing every segment one by one. */
+class VRPROJECT_API FTeleportArc
+{
+public:
+
+	float simFrequency; /** Segments traced per second of flight. */
+	float maxSimTime; /** Maximum seconds of flight to trace. */
+	int32 blockSize; /** Number of segments tested together by a single overlap before tracing them individually. */
+	float coherentDistance; /** Max distance the start can move between traces to reuse the last hit segment. */
+	float coherentAngle; /** Max angle in degrees the aim can turn between traces to reuse the last hit segment. */
+
+	/** Constructor. */
+	FTeleportArc();
+
+	/** Trace the arc from a start location and velocity.
+	 * @Param world, The world to trace in.
+	 * @Param start, World location the arc is launched from.
+	 * @Param launchVelocity, Velocity the arc is launched at.
+	 * @Param gravityZ, Gravity applied along the arc.
+	 * @Param channel, Channel to trace each segment on.
+	 * @Param queryParams, Query params used for every trace and overlap.
+	 * @Return true if the arc hit something. */
+	bool Trace(UWorld* world, const FVector& start, const FVector& launchVelocity, float gravityZ, ECollisionChannel channel, const FCollisionQueryParams& queryParams);
+
+	/** Queue the arc to be traced asynchronously, every step is traced off the game thread alongside the rest of the frame.
+	 * NOTE: The result is collected next frame with ResolveAsync. Parameters are the same as Trace. */
+	void TraceAsync(UWorld* world, const FVector& start, const FVector& launchVelocity, float gravityZ, ECollisionChannel channel, const FCollisionQueryParams& queryParams);
+
+	/** Collect the arc queued with TraceAsync last frame and make it the current arc.
+	 * @Return true if a queued arc was collected, false if nothing was queued or its results are no longer available. */
+	bool ResolveAsync(UWorld* world);
+
+	/** Drop any queued asynchronous arc. */
+	FORCEINLINE void CancelAsync() { pendingTraces.Reset(); }
+
+	/** @Return true if an asynchronous arc is waiting to be collected. */
+	FORCEINLINE bool IsAsyncPending() const { return pendingTraces.Num() > 0; }
+
+	/** Forget the last trace so the next one starts from the beginning of the arc. */
+	void Reset();
+
+	/** @Return the location along the arc at a time of flight. */
+	FORCEINLINE FVector GetLocationAtTime(float time) const
+	{
+		return arcStart + arcVelocity * time + FVector(0.0f, 0.0f, 0.5f * arcGravity * time * time);
+	}
+
+	/** @Return the velocity along the arc at a time of flight. Multiply by a segments duration to get its spline tangent. */
+	FORCEINLINE FVector GetVelocityAtTime(float time) const
+	{
+		return arcVelocity + FVector(0.0f, 0.0f, arcGravity * time);
+	}
+
+	/** @Return the time of flight the arc ends at, either the hit or the max sim time. */
+	FORCEINLINE float GetEndTime() const { return endTime; }
+
+	/** @Return the location the arc ends at, either the hit location or the end of the max sim time. */
+	FORCEINLINE const FVector& GetEndLocation() const { return endLocation; }
+
+	/** @Return the number of sim steps up to the end of the arc, including a partial final step. */
+	int32 GetStepCount() const;
+
+	/** Sample the traced arc for drawing, placing fewer samples where the arc is near straight or far from the viewer.
+	 * Each segment is as long as possible while the chord stays within the error angle of the curve as seen from the view location.
+	 * @Param viewLocation, Location the arc is seen from.
+	 * @Param errorAngle, Max angle in degrees a segment can stray from the curve as seen from the view location.
+	 * @Param maxSegments, Hard cap on the number of segments, the arc is never drawn with more.
+	 * @Param outPoints, Locations along the arc ending at the end location.
+	 * @Param outDirections, Direction of the arc at each location. */
+	void Sample(const FVector& viewLocation, float errorAngle, int32 maxSegments, TArray<FVector>& outPoints, TArray<FVector>& outDirections) const;
+
+	/** @Return true if the last trace hit something. */
+	FORCEINLINE bool HasHit() const { return hasHit; }
+
+	/** @Return the hit from the last trace, only valid if HasHit. */
+	FORCEINLINE const FHitResult& GetHit() const { return hit; }
+
+	/** @Return the number of traces and overlaps issued by the last trace. */
+	FORCEINLINE int32 GetQueryCount() const { return queryCount; }
+
+private:
+
+	FVector arcStart; /** Launch location of the current arc. */
+	FVector arcVelocity; /** Launch velocity of the current arc. */
+	float arcGravity; /** Gravity of the current arc. */
+	float endTime; /** Time of flight the current arc ends at. */
+	FVector endLocation; /** Location the current arc ends at. */
+	bool hasHit; /** Did the current arc hit something. */
+	FHitResult hit; /** Hit of the current arc. */
+	int32 queryCount; /** Traces and overlaps issued by the last trace. */
+	int32 lastHitStep; /** Step the last arc hit on, INDEX_NONE if it didn't hit. */
+	FVector lastStart; /** Launch location of the last arc. */
+	FVector lastVelocity; /** Launch velocity of the last arc. */
+	float lastGravity; /** Gravity of the last arc. */
+	FVector pendingStart; /** Launch location of the queued asynchronous arc. */
+	FVector pendingVelocity; /** Launch velocity of the queued asynchronous arc. */
+	float pendingGravity; /** Gravity of the queued asynchronous arc. */
+	TArray<FTraceHandle> pendingTraces; /** Handle of each step of the queued asynchronous arc. */
+
+	/** @Return the time of flight at the start of a step. */
+	FORCEINLINE float GetStepTime(int32 step) const
+	{
+		return FMath::Min(step / simFrequency, maxSimTime);
+	}
+
+	/** @Return true if the new arc is close enough to the last one that its hit segment is worth testing first. */
+	bool IsCoherent(const FVector& start, const FVector& launchVelocity, float gravityZ) const;
+
+	/** Test if the segments between two steps are definitely clear by overlapping their bounds once.
+	 * @Return true if nothing is inside the bounds, false if the segments need tracing. */
+	bool IsRangeClear(UWorld* world, int32 firstStep, int32 lastStep, ECollisionChannel channel, const FCollisionQueryParams& queryParams);
+
+	/** Trace a single step, updating the hit and end of the arc if it blocks.
+	 * @Return true if the step hit something. */
+	bool TraceStep(UWorld* world, int32 step, ECollisionChannel channel, const FCollisionQueryParams& queryParams);
+};
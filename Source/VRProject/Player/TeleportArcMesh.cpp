@@ -0,0 +1,95 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Player/TeleportArcMesh.h"
+
+FTeleportArcMesh::FTeleportArcMesh()
+{
+	ringCount = 0;
+	sideCount = 0;
+	tubeRadius = 0.0f;
+}
+
+void FTeleportArcMesh::Init(int32 maxSegments, int32 sides, float radius)
+{
+	ringCount = FMath::Max(maxSegments, 1) + 1;
+	sideCount = FMath::Max(sides, 3);
+	tubeRadius = radius;
+	int32 ringVertices = sideCount + 1;
+
+	// Precompute the offsets around a ring, the last vertex repeats the first so the UVs can wrap.
+	ringOffsets.SetNumUninitialized(ringVertices);
+	for (int32 side = 0; side < ringVertices; side++)
+	{
+		float angle = (2.0f * PI * side) / sideCount;
+		ringOffsets[side] = FVector2D(FMath::Cos(angle), FMath::Sin(angle));
+	}
+
+	// Size the vertex buffers and lay the UVs out around and along the tube.
+	vertices.SetNumZeroed(ringCount * ringVertices);
+	normals.SetNumZeroed(ringCount * ringVertices);
+	uvs.SetNumUninitialized(ringCount * ringVertices);
+	for (int32 ring = 0; ring < ringCount; ring++)
+	{
+		for (int32 side = 0; side < ringVertices; side++)
+		{
+			uvs[ring * ringVertices + side] = FVector2D((float)side / sideCount, (float)ring / (ringCount - 1));
+		}
+	}
+
+	// Join each ring to the next with a quad per side, wound to face out from the arc.
+	triangles.Reset((ringCount - 1) * sideCount * 6);
+	for (int32 ring = 0; ring < ringCount - 1; ring++)
+	{
+		for (int32 side = 0; side < sideCount; side++)
+		{
+			int32 current = ring * ringVertices + side;
+			int32 next = current + ringVertices;
+			triangles.Add(current);
+			triangles.Add(next);
+			triangles.Add(current + 1);
+			triangles.Add(current + 1);
+			triangles.Add(next);
+			triangles.Add(next + 1);
+		}
+	}
+}
+
+void FTeleportArcMesh::Update(const FVector* points, const FVector* directions, int32 pointCount)
+{
+	if (!IsInitialized()) return;
+	int32 ringVertices = sideCount + 1;
+	int32 usedRings = FMath::Clamp(pointCount, 0, ringCount);
+
+	// Carry the side vector from ring to ring so the tube doesn't twist as the arc bends.
+	FVector side = FVector::ZeroVector;
+	for (int32 ring = 0; ring < usedRings; ring++)
+	{
+		FVector direction = directions[ring].GetSafeNormal();
+		side = side - direction * (side | direction);
+		if (!side.Normalize())
+		{
+			side = direction ^ FVector::UpVector;
+			if (!side.Normalize()) side = direction ^ FVector::ForwardVector;
+			side.Normalize();
+		}
+		FVector up = direction ^ side;
+
+		// Place the ring around the point.
+		FVector* ringVertex = vertices.GetData() + ring * ringVertices;
+		FVector* ringNormal = normals.GetData() + ring * ringVertices;
+		for (int32 i = 0; i < ringVertices; i++)
+		{
+			FVector offset = side * ringOffsets[i].X + up * ringOffsets[i].Y;
+			ringVertex[i] = points[ring] + offset * tubeRadius;
+			ringNormal[i] = offset;
+		}
+	}
+
+	// Collapse any unused rings onto the end so their triangles have no area.
+	FVector end = usedRings > 0 ? points[usedRings - 1] : FVector::ZeroVector;
+	for (int32 i = usedRings * ringVertices; i < vertices.Num(); i++)
+	{
+		vertices[i] = end;
+		normals[i] = FVector::UpVector;
+	}
+}
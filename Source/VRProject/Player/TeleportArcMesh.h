@@ -0,0 +1,45 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+#include "CoreMinimal.h"
+
+/** Builds the vertex data of an open ended tube along the teleport arc. The triangles and UVs are built once for the max amount of segments
+ * and only the vertices and normals are rewritten each frame, so the mesh section can be updated in place without reallocating.
+ * NOTE: Only uses core math types so it can be built and checked without a world or renderer. Unused rings are collapsed onto the end point. */
+class VRPROJECT_API FTeleportArcMesh
+{
+public:
+
+	TArray<FVector> vertices; /** Vertex positions, a ring of sides + 1 vertices per arc point. */
+	TArray<FVector> normals; /** Vertex normals pointing out from the arc. */
+	TArray<FVector2D> uvs; /** Around the tube in U and along it in V. */
+	TArray<int32> triangles; /** Triangle indices joining each ring to the next. */
+
+	/** Constructor. */
+	FTeleportArcMesh();
+
+	/** Build the triangles and UVs and size the vertex buffers.
+	 * @Param maxSegments, Most segments the arc can be drawn with.
+	 * @Param sides, Number of sides around the tube.
+	 * @Param radius, Radius of the tube. */
+	void Init(int32 maxSegments, int32 sides, float radius);
+
+	/** @Return true once Init has been called. */
+	FORCEINLINE bool IsInitialized() const { return ringCount > 0; }
+
+	/** @Return the most segments the arc can be drawn with. */
+	FORCEINLINE int32 GetMaxSegments() const { return ringCount - 1; }
+
+	/** Rewrite the vertices and normals along the given points.
+	 * @Param points, Locations along the arc, clamped to max segments + 1.
+	 * @Param directions, Direction of the arc at each point.
+	 * @Param pointCount, Number of points, at least 2 to draw anything. */
+	void Update(const FVector* points, const FVector* directions, int32 pointCount);
+
+private:
+
+	int32 ringCount; /** Number of rings in the buffers, max segments + 1. */
+	int32 sideCount; /** Number of sides around the tube. */
+	float tubeRadius; /** Radius of the tube. */
+	TArray<FVector2D> ringOffsets; /** Cos and sin around the ring for each vertex. */
+};
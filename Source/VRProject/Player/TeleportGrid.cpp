@@ -0,0 +1,186 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Player/TeleportGrid.h"
+#include "HAL/PlatformFilemanager.h"
+#include "Async/MappedFileHandle.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY(LogTeleportGrid);
+
+FTeleportGridHeader::FTeleportGridHeader()
+{
+	magic = FTeleportGrid::fileMagic;
+	version = FTeleportGrid::fileVersion;
+	originX = 0.0f;
+	originY = 0.0f;
+	cellSize = 25.0f;
+	sizeX = 0;
+	sizeY = 0;
+	spanCount = 0;
+	columnCount = 0;
+	floorCount = 0;
+	agentRadius = 0.0f;
+	agentHeight = 0.0f;
+	searchDistance = 0.0f;
+}
+
+FTeleportGrid::FTeleportGrid()
+{
+	header = nullptr;
+	rowStarts = nullptr;
+	spans = nullptr;
+	columnStarts = nullptr;
+	floors = nullptr;
+	stale = false;
+}
+
+FTeleportGrid::~FTeleportGrid()
+{
+	Unload();
+}
+
+bool FTeleportGrid::Load(const FString& mapName, float agentRadius, float agentHeight, float searchDistance)
+{
+	Unload();
+	FString path = GetGridPath(mapName);
+	if (!FPaths::FileExists(path)) return false;
+
+	// Map the file where supported, otherwise read it into memory.
+	mappedFile.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*path));
+	if (mappedFile) mappedRegion.Reset(mappedFile->MapRegion());
+	bool loaded = false;
+	if (mappedRegion) loaded = SetData(mappedRegion->GetMappedPtr(), mappedRegion->GetMappedSize());
+	else if (FFileHelper::LoadFileToArray(loadedData, *path)) loaded = SetData(loadedData.GetData(), loadedData.Num());
+	if (!loaded)
+	{
+		UE_LOG(LogTeleportGrid, Warning, TEXT("The teleport grid %s is invalid or out of date, rebake it with the TeleportGrid commandlet."), *path);
+		Unload();
+		return false;
+	}
+
+	// A grid baked for a different agent doesn't match the nav mesh being teleported on.
+	if (!FMath::IsNearlyEqual(header->agentRadius, agentRadius) || !FMath::IsNearlyEqual(header->agentHeight, agentHeight))
+	{
+		UE_LOG(LogTeleportGrid, Warning, TEXT("The teleport grid %s was baked for a different nav agent, rebake it with the TeleportGrid commandlet."), *path);
+		Unload();
+		return false;
+	}
+
+	// Nor does one baked with a different search distance project the same way.
+	if (!FMath::IsNearlyEqual(header->searchDistance, searchDistance))
+	{
+		UE_LOG(LogTeleportGrid, Warning, TEXT("The teleport grid %s was baked with a different teleport search distance, rebake it with the TeleportGrid commandlet."), *path);
+		Unload();
+		return false;
+	}
+	return true;
+}
+
+void FTeleportGrid::Unload()
+{
+	header = nullptr;
+	rowStarts = nullptr;
+	spans = nullptr;
+	columnStarts = nullptr;
+	floors = nullptr;
+	stale = false;
+	mappedRegion.Reset();
+	mappedFile.Reset();
+	loadedData.Empty();
+}
+
+bool FTeleportGrid::Find(const FVector& location, bool& outValid, FVector& outLocation) const
+{
+	if (!IsUsable()) return false;
+
+	// Leave anything outside of the grid to the nav mesh.
+	int32 x = FMath::FloorToInt((location.X - header->originX) / header->cellSize);
+	int32 y = FMath::FloorToInt((location.Y - header->originY) / header->cellSize);
+	if (x < 0 || y < 0 || x >= header->sizeX || y >= header->sizeY) return false;
+
+	// Every cell inside the grid was sampled, so the location is only valid if the surface nearest to it within the search distance is.
+	outValid = false;
+	int32 column = FindColumn(x, y);
+	if (column == INDEX_NONE) return true;
+	const FTeleportGridFloor* nearest = nullptr;
+	float nearestDistance = header->searchDistance;
+	for (uint32 i = columnStarts[column]; i < columnStarts[column + 1]; i++)
+	{
+		float distance = FMath::Abs(floors[i].z - location.Z);
+		if (distance <= nearestDistance)
+		{
+			nearestDistance = distance;
+			nearest = &floors[i];
+		}
+	}
+	if (!nearest || !(nearest->flags & FTeleportGridFloor::validFlag)) return true;
+
+	// Keep the queried point on the floor unless the projection had to move it, the same as projecting it onto the nav mesh would.
+	outValid = true;
+	outLocation = (nearest->flags & FTeleportGridFloor::snappedFlag) ? FVector(nearest->x, nearest->y, nearest->z) : FVector(location.X, location.Y, nearest->z);
+	return true;
+}
+
+bool FTeleportGrid::Save(const FString& mapName, const FTeleportGridHeader& gridHeader, const TArray<uint32>& gridRowStarts, const TArray<FTeleportGridSpan>& gridSpans, const TArray<uint32>& gridColumnStarts, const TArray<FTeleportGridFloor>& gridFloors)
+{
+	if (gridRowStarts.Num() != gridHeader.sizeY + 1 || gridSpans.Num() != gridHeader.spanCount) return false;
+	if (gridColumnStarts.Num() != gridHeader.columnCount + 1 || gridFloors.Num() != gridHeader.floorCount) return false;
+
+	// Write the header and arrays exactly as they are laid out in memory so the file can be mapped.
+	TArray<uint8> data;
+	data.Append((const uint8*)&gridHeader, sizeof(FTeleportGridHeader));
+	data.Append((const uint8*)gridRowStarts.GetData(), gridRowStarts.Num() * sizeof(uint32));
+	data.Append((const uint8*)gridSpans.GetData(), gridSpans.Num() * sizeof(FTeleportGridSpan));
+	data.Append((const uint8*)gridColumnStarts.GetData(), gridColumnStarts.Num() * sizeof(uint32));
+	data.Append((const uint8*)gridFloors.GetData(), gridFloors.Num() * sizeof(FTeleportGridFloor));
+	return FFileHelper::SaveArrayToFile(data, *GetGridPath(mapName));
+}
+
+FString FTeleportGrid::GetGridPath(const FString& mapName)
+{
+	return FPaths::Combine(FPaths::ProjectContentDir(), TEXT("TeleportGrids"), mapName + TEXT(".vrtg"));
+}
+
+bool FTeleportGrid::SetData(const uint8* data, int64 size)
+{
+	if (!data || size < (int64)sizeof(FTeleportGridHeader)) return false;
+	const FTeleportGridHeader* gridHeader = (const FTeleportGridHeader*)data;
+	if (gridHeader->magic != fileMagic || gridHeader->version != fileVersion) return false;
+	if (gridHeader->sizeX < 0 || gridHeader->sizeY < 0 || gridHeader->cellSize <= 0.0f) return false;
+	if (gridHeader->spanCount < 0 || gridHeader->columnCount < 0 || gridHeader->floorCount < 0) return false;
+
+	// Check the arrays fit in the file before pointing at them.
+	int64 rowCount = (int64)gridHeader->sizeY + 1;
+	int64 columnCount = (int64)gridHeader->columnCount + 1;
+	int64 expectedSize = sizeof(FTeleportGridHeader) + rowCount * sizeof(uint32) + (int64)gridHeader->spanCount * sizeof(FTeleportGridSpan)
+		+ columnCount * sizeof(uint32) + (int64)gridHeader->floorCount * sizeof(FTeleportGridFloor);
+	if (size != expectedSize) return false;
+	const uint32* gridRowStarts = (const uint32*)(data + sizeof(FTeleportGridHeader));
+	const FTeleportGridSpan* gridSpans = (const FTeleportGridSpan*)(gridRowStarts + rowCount);
+	const uint32* gridColumnStarts = (const uint32*)(gridSpans + gridHeader->spanCount);
+	if (gridRowStarts[rowCount - 1] != (uint32)gridHeader->spanCount || gridColumnStarts[columnCount - 1] != (uint32)gridHeader->floorCount) return false;
+
+	header = gridHeader;
+	rowStarts = gridRowStarts;
+	spans = gridSpans;
+	columnStarts = gridColumnStarts;
+	floors = (const FTeleportGridFloor*)(gridColumnStarts + columnCount);
+	return true;
+}
+
+int32 FTeleportGrid::FindColumn(int32 x, int32 y) const
+{
+	// Binary search the spans of the row, they are stored in order along X.
+	uint32 first = rowStarts[y];
+	uint32 last = rowStarts[y + 1];
+	while (first < last)
+	{
+		uint32 middle = first + (last - first) / 2;
+		const FTeleportGridSpan& span = spans[middle];
+		if (x < span.startX) last = middle;
+		else if (x >= span.endX) first = middle + 1;
+		else return span.firstColumn + (x - span.startX);
+	}
+	return INDEX_NONE;
+}
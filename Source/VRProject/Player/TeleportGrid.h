@@ -0,0 +1,131 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+#include "CoreMinimal.h"
+
+/** Declare log type for the teleport grid. */
+DECLARE_LOG_CATEGORY_EXTERN(LogTeleportGrid, Log, All);
+
+/** Define classes used. */
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/** Header at the start of a baked teleport grid file. Followed by (sizeY + 1) uint32 row starts, spanCount spans, (columnCount + 1) uint32 column starts
+ * and then floorCount floors.
+ * NOTE: Written and mapped as is, so it must stay plain data with no padding. */
+struct FTeleportGridHeader
+{
+	uint32 magic; /** Identifies a teleport grid file. */
+	int32 version; /** Layout version of the file. */
+	float originX; /** World X of the corner of the first cell. */
+	float originY; /** World Y of the corner of the first cell. */
+	float cellSize; /** Size of each cell in cm. */
+	int32 sizeX; /** Number of cells along X. */
+	int32 sizeY; /** Number of cells along Y. */
+	int32 spanCount; /** Total number of spans of occupied cells stored. */
+	int32 columnCount; /** Total number of occupied cells stored. */
+	int32 floorCount; /** Total number of floors stored. */
+	float agentRadius; /** Radius of the nav agent the grid was baked for. */
+	float agentHeight; /** Height of the nav agent the grid was baked for. */
+	float searchDistance; /** Teleport search distance used when projecting onto the nav mesh. */
+
+	/** Constructor. */
+	FTeleportGridHeader();
+};
+
+/** A run of neighbouring cells along a row of the grid that have at least one surface, whose columns are stored consecutively.
+ * NOTE: Written and mapped as is, so it must stay plain data with no padding. */
+struct FTeleportGridSpan
+{
+	int32 startX; /** First cell of the span. */
+	int32 endX; /** One past the last cell of the span. */
+	uint32 firstColumn; /** Index of the column of the first cell. */
+};
+
+/** A surface baked into a teleport grid cell, the result of projecting the surface under the cells centre onto the nav mesh.
+ * NOTE: Written and mapped as is, so it must stay plain data with no padding. */
+struct FTeleportGridFloor
+{
+	static const uint32 validFlag = 1 << 0; /** The surface projected onto the nav mesh. */
+	static const uint32 snappedFlag = 1 << 1; /** The projection moved the point out of its cell, e.g. towards the edge of the nav mesh. */
+
+	float x; /** World X of the projected point, or of the surface if it isn't valid. */
+	float y; /** World Y of the projected point, or of the surface if it isn't valid. */
+	float z; /** Corrected floor height at the projected point, or the height of the surface if it isn't valid. */
+	uint32 flags; /** Combination of the flags above. */
+};
+
+/** A baked grid of teleport projections for a level. Each cell holds every teleportable surface above or below its centre, either as the projected point and
+ * corrected floor height or marked as not on the nav mesh, so teleport locations inside the grid are resolved without a nav query. Cells are stored sparsely
+ * as spans of occupied cells per row, and the file is memory mapped where the platform supports it.
+ * NOTE: Every cell inside the grid is sampled, so a cell with no surfaces can't be teleported to. Baked by the TeleportGrid commandlet into
+ * Content/TeleportGrids, which is staged as loose files. Becomes stale if the nav mesh is rebuilt at runtime. */
+class VRPROJECT_API FTeleportGrid
+{
+public:
+
+	/** Identifies and versions teleport grid files. */
+	static const uint32 fileMagic = 0x56525447; // VRTG
+	static const int32 fileVersion = 3;
+
+	/** Constructor and destructor. */
+	FTeleportGrid();
+	~FTeleportGrid();
+
+	/** Map the grid baked for a level, unloading any current grid.
+	 * @Param mapName, Short name of the level.
+	 * @Param agentRadius, Radius of the nav agent teleporting, the grid is rejected if baked for a different agent.
+	 * @Param agentHeight, Height of the nav agent teleporting.
+	 * @Param searchDistance, Teleport search distance used when projecting, the grid is rejected if baked with a different distance.
+	 * @Return true if a usable grid was loaded. */
+	bool Load(const FString& mapName, float agentRadius, float agentHeight, float searchDistance);
+
+	/** Release the current grid. */
+	void Unload();
+
+	/** @Return true if a grid is loaded and hasn't been made stale. */
+	FORCEINLINE bool IsUsable() const { return header && !stale; }
+
+	/** Stop using the grid, e.g. because the nav mesh has been rebuilt since it was baked. */
+	FORCEINLINE void MarkStale() { stale = true; }
+
+	/** Look up a teleport location in the grid, using the surface baked nearest to it in its cell. The location keeps its X and Y on the floor unless
+	 * the bake had to move it out of its cell.
+	 * @Param location, The location being validated.
+	 * @Param outValid, Is there a valid floor within the search distance of the location.
+	 * @Param outLocation, The corrected teleport location, only set if valid.
+	 * @Return true if the location is inside the grid, false if it needs validating against the nav mesh. */
+	bool Find(const FVector& location, bool& outValid, FVector& outLocation) const;
+
+	/** Write a baked grid for a level.
+	 * @Param mapName, Short name of the level.
+	 * @Param gridHeader, The header, its counts must match the arrays.
+	 * @Param gridRowStarts, Index of the first span of each row, with a final entry of the total spans.
+	 * @Param gridSpans, The spans of occupied cells of every row in order.
+	 * @Param gridColumnStarts, Index of the first floor of each occupied cell, with a final entry of the total floors.
+	 * @Param gridFloors, The floors of every occupied cell in order.
+	 * @Return true if the file was written. */
+	static bool Save(const FString& mapName, const FTeleportGridHeader& gridHeader, const TArray<uint32>& gridRowStarts, const TArray<FTeleportGridSpan>& gridSpans, const TArray<uint32>& gridColumnStarts, const TArray<FTeleportGridFloor>& gridFloors);
+
+	/** @Return the path of the grid file for a level. */
+	static FString GetGridPath(const FString& mapName);
+
+private:
+
+	TUniquePtr<IMappedFileHandle> mappedFile; /** The mapped grid file. */
+	TUniquePtr<IMappedFileRegion> mappedRegion; /** The mapped view of the whole file. */
+	TArray<uint8> loadedData; /** The grid file read into memory on platforms that can't map it. */
+	const FTeleportGridHeader* header; /** The grid header, null if nothing is loaded. */
+	const uint32* rowStarts; /** Index of the first span of each row. */
+	const FTeleportGridSpan* spans; /** Spans of occupied cells. */
+	const uint32* columnStarts; /** Index of the first floor of each occupied cell. */
+	const FTeleportGridFloor* floors; /** Floors of every occupied cell. */
+	bool stale; /** Has the grid been marked stale. */
+
+	/** Point the header and arrays at loaded data, checking the layout.
+	 * @Return true if the data is a valid grid. */
+	bool SetData(const uint8* data, int64 size);
+
+	/** @Return the column of an occupied cell, or INDEX_NONE if the cell has no surfaces. */
+	int32 FindColumn(int32 x, int32 y) const;
+};
@@ -0,0 +1,114 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Player/TeleportNavCache.h"
+
+FTeleportNavCache::FTeleportNavCache()
+{
+	cellSize = 10.0f;
+	capacity = 0;
+	head = INDEX_NONE;
+	tail = INDEX_NONE;
+	hits = 0;
+	misses = 0;
+}
+
+void FTeleportNavCache::Init(float newCellSize, int32 newCapacity)
+{
+	cellSize = FMath::Max(newCellSize, 1.0f);
+	capacity = FMath::Max(newCapacity, 1);
+	entries.Reset(capacity);
+	lookup.Reserve(capacity);
+	Clear();
+}
+
+void FTeleportNavCache::Clear()
+{
+	entries.Reset();
+	lookup.Reset();
+	head = INDEX_NONE;
+	tail = INDEX_NONE;
+	hits = 0;
+	misses = 0;
+}
+
+bool FTeleportNavCache::Find(const FVector& location, bool& outValid, FVector& outLocation)
+{
+	int32* found = lookup.Find(GetCell(location));
+	if (!found)
+	{
+		misses++;
+		return false;
+	}
+	hits++;
+
+	// Move to the front of the use order.
+	int32 index = *found;
+	Unlink(index);
+	LinkHead(index);
+
+	// Keep the queried point on the cached floor unless the projection had to move it, so the result doesn't step between cells.
+	const FEntry& entry = entries[index];
+	outValid = entry.valid;
+	if (entry.valid) outLocation = entry.snapped ? FVector(entry.projected.X, entry.projected.Y, entry.floorHeight) : FVector(location.X, location.Y, entry.floorHeight);
+	return true;
+}
+
+void FTeleportNavCache::Add(const FVector& location, bool valid, const FVector& projected, float floorHeight)
+{
+	if (capacity <= 0) return;
+	FIntVector cell = GetCell(location);
+	int32 index = INDEX_NONE;
+	if (int32* found = lookup.Find(cell))
+	{
+		index = *found;
+		Unlink(index);
+	}
+	// Use a new entry until the budget is reached.
+	else if (entries.Num() < capacity)
+	{
+		index = entries.AddUninitialized();
+		lookup.Add(cell, index);
+	}
+	// Otherwise reuse the least recently used entry.
+	else
+	{
+		index = tail;
+		Unlink(index);
+		lookup.Remove(entries[index].cell);
+		lookup.Add(cell, index);
+	}
+
+	FEntry& entry = entries[index];
+	entry.cell = cell;
+	entry.projected = projected;
+	entry.floorHeight = floorHeight;
+	entry.valid = valid;
+	entry.snapped = valid && GetCell(FVector(projected.X, projected.Y, location.Z)) != cell;
+	LinkHead(index);
+}
+
+FIntVector FTeleportNavCache::GetCell(const FVector& location) const
+{
+	return FIntVector(FMath::FloorToInt(location.X / cellSize), FMath::FloorToInt(location.Y / cellSize), FMath::FloorToInt(location.Z / cellSize));
+}
+
+void FTeleportNavCache::Unlink(int32 index)
+{
+	FEntry& entry = entries[index];
+	if (entry.prev != INDEX_NONE) entries[entry.prev].next = entry.next;
+	else head = entry.next;
+	if (entry.next != INDEX_NONE) entries[entry.next].prev = entry.prev;
+	else tail = entry.prev;
+	entry.prev = INDEX_NONE;
+	entry.next = INDEX_NONE;
+}
+
+void FTeleportNavCache::LinkHead(int32 index)
+{
+	FEntry& entry = entries[index];
+	entry.prev = INDEX_NONE;
+	entry.next = head;
+	if (head != INDEX_NONE) entries[head].prev = index;
+	head = index;
+	if (tail == INDEX_NONE) tail = index;
+}
@@ -0,0 +1,73 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+#include "CoreMinimal.h"
+
+/** Caches teleport nav-mesh projections in a quantized spatial hash so aiming over the same floor doesn't project the same point every frame.
+ * Each cell holds the projected point and the corrected floor height. The least recently used cell is evicted once the budget is reached.
+ * NOTE: Must be cleared whenever the nav mesh changes. */
+class VRPROJECT_API FTeleportNavCache
+{
+public:
+
+	/** Constructor. */
+	FTeleportNavCache();
+
+	/** Set the cell size and budget, clearing the cache.
+	 * @Param newCellSize, Size of each cell in cm, queries in the same cell share a result.
+	 * @Param newCapacity, Most cells kept before the least recently used is evicted. */
+	void Init(float newCellSize, int32 newCapacity);
+
+	/** Remove every cached cell. */
+	void Clear();
+
+	/** Find the cached result for the cell containing a location, marking it as most recently used.
+	 * @Param location, The location being validated.
+	 * @Param outValid, Was the cell on the nav mesh.
+	 * @Param outLocation, The corrected teleport location, only set if valid.
+	 * @Return true if the cell was cached. */
+	bool Find(const FVector& location, bool& outValid, FVector& outLocation);
+
+	/** Cache the result for the cell containing a location, evicting the least recently used cell if full.
+	 * @Param location, The location that was validated.
+	 * @Param valid, Was the location on the nav mesh.
+	 * @Param projected, The point projected onto the nav mesh.
+	 * @Param floorHeight, The corrected height of the floor at the projected point. */
+	void Add(const FVector& location, bool valid, const FVector& projected, float floorHeight);
+
+	/** @Return the number of cached cells. */
+	FORCEINLINE int32 Num() const { return lookup.Num(); }
+
+	int32 hits; /** Finds that returned a cached cell since the last clear. */
+	int32 misses; /** Finds that missed since the last clear. */
+
+private:
+
+	/** A cached cell, linked in order of use. */
+	struct FEntry
+	{
+		FIntVector cell; /** The quantized location. */
+		FVector projected; /** Point projected onto the nav mesh. */
+		float floorHeight; /** Corrected floor height at the projected point. */
+		bool valid; /** Was the cell on the nav mesh. */
+		bool snapped; /** The projection moved the point out of its cell, e.g. towards the edge of the nav mesh. */
+		int32 prev; /** More recently used entry. */
+		int32 next; /** Less recently used entry. */
+	};
+
+	float cellSize; /** Size of each cell in cm. */
+	int32 capacity; /** Most cells kept. */
+	TArray<FEntry> entries; /** Storage for every cell, never grows past capacity. */
+	TMap<FIntVector, int32> lookup; /** Cell to entry index. */
+	int32 head; /** Most recently used entry. */
+	int32 tail; /** Least recently used entry. */
+
+	/** @Return the cell containing a location. */
+	FIntVector GetCell(const FVector& location) const;
+
+	/** Unlink an entry from the use order. */
+	void Unlink(int32 index);
+
+	/** Link an entry as the most recently used. */
+	void LinkHead(int32 index);
+};
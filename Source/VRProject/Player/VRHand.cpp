@@ -6,6 +6,9 @@
 #include "Project/VRPhysicsHandleComponent.h"
 #include "Project/VRFunctionLibrary.h"
 #include "Project/EffectsContainer.h"
+#include "Project/CollisionClearanceComponent.h"
+#include "Project/HapticScheduler.h"
+#include "Project/TickTrace.h"
 #include "XRMotionControllerBase.h"
 #include "Haptics/HapticFeedbackEffect_Base.h"
 #include "TimerManager.h"
@@ -20,6 +23,7 @@
 #include "Components/SphereComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "Interactables/GrabbableActor.h"
+#include "Interactables/GrabbableSubsystem.h"
 #include "Animation/AnimInstance.h"
 #include "Animation/AnimBlueprint.h"
 #include "Animation/AnimBlueprintGeneratedClass.h"
@@ -35,22 +39,36 @@
 
 DEFINE_LOG_CATEGORY(LogHand);
 
+uint32 AVRHand::interfaceCacheGeneration = 0;
+
 AVRHand::AVRHand()
 {
-	// Tick for this function is ran in the pawn class.
-	PrimaryActorTick.bCanEverTick = false; 
+	// Tick is enabled once the hand is setup by the player, it runs after the players input snapshot and this hands controller pose
+	// and before its physics handles. There is no dependency between the hands so they can be scheduled independently.
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
+	PrimaryActorTick.TickGroup = TG_PrePhysics;
 
 	// Setup motion controller. Default setup.
 	controller = CreateDefaultSubobject<UMotionControllerComponent>("Controller");
 	controller->MotionSource = FXRMotionControllerBase::LeftHandSourceId;
 	controller->SetupAttachment(scene);
-	controller->bDisableLowLatencyUpdate = true;
+	controller->bDisableLowLatencyUpdate = true; // Enabled in begin play when using low latency visuals.
 	RootComponent = controller;
 
 	// handRoot comp.
 	handRoot = CreateDefaultSubobject<USceneComponent>(TEXT("HandRoot"));
 	handRoot->SetupAttachment(controller);
 
+	// Visual root for the hand skel while using low latency visuals.
+	handVisual = CreateDefaultSubobject<USceneComponent>(TEXT("HandVisual"));
+	handVisual->SetupAttachment(handRoot);
+	heldVisual = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("HeldVisual"));
+	heldVisual->SetCollisionProfileName("NoCollision");
+	heldVisual->SetGenerateOverlapEvents(false);
+	heldVisual->SetVisibility(false);
+	heldVisual->SetupAttachment(handVisual);
+
 	// Setup hand physics. Default setup.
 	handPhysics = CreateDefaultSubobject<UBoxComponent>("handBox");
 	handPhysics->SetCollisionProfileName("PhysicsActor");
@@ -68,6 +86,7 @@ AVRHand::AVRHand()
 	handSkel->SetRenderCustomDepth(true);
 	handSkel->SetGenerateOverlapEvents(true);
 	handSkel->SetCustomDepthStencilValue(1);
+	handSkel->bEnableUpdateRateOptimizations = true;
 	handSkel->SetRelativeTransform(FTransform(FRotator(-1.0f, 0.0f, 0.0f), FVector(-10.4f, 0.45f, -0.8f), FVector(0.27f, 0.27f, 0.27f)));
 
 	// Collider to find interactables. Default setup.
@@ -98,9 +117,6 @@ AVRHand::AVRHand()
 	widgetInteractor->InteractionSource = EWidgetInteractionSource::World;
 	widgetInteractor->bEnableHitTesting = true;
 
-	// Ensure fast widget path is disabled as it optimizes away the functionality we need when building in VR.
-	GSlateFastWidgetPath = 0;
-
 	// Setup movement direction component.
 	movementTarget = CreateDefaultSubobject<USceneComponent>("MovementTarget");
 	movementTarget->SetMobility(EComponentMobility::Movable);
@@ -115,21 +131,60 @@ AVRHand::AVRHand()
 	grabbing = false;
 	foundController = false;
 	hideOnGrab = true;	
+	lowLatencyVisuals = false;
+	heldVisualSourceVisible = false;
+	hiddenAnimUpdateRate = 4;
 	active = true;
 	collisionEnabled = false;
 	thumbstick = FVector2D(0.0f, 0.0f);
 	distanceFrameCount = 0;
 	debug = false;
 	telekineticGrab = true;
+	telekineticRange = 1000.0f;
+	telekineticConeAngle = 20.0f;
+	telekineticSwept = false;
+	telekineticPulling = false;
+	telekineticAimLocation = FVector::ZeroVector;
+	telekineticAimDirection = FVector::ZeroVector;
+	telekineticStartRot = FQuat::Identity;
+	telekineticPullData = FPhysicsHandleData(true);
+	telekineticPullData.updateTargetLocation = false;
 	devModeEnabled = false;
 	devModeCurlAlpha = 0.0f;
 	openedSinceGrabbed = true;
+	candidateUpdateDistance = 1.0f;
+	velocitySampleCount = 4;
+	colliderStateCount = 6;
+	colliderStateHysteresis = 0.05f;
+	currentColliderState = -1;
+	candidatesChanged = false;
+	lastCandidateCheckLocation = FVector::ZeroVector;
 }
 
 void AVRHand::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// Resolve the collision presets used when toggling collision on the hand physics.
+	physicsPreset = FCollisionPreset::Find("PhysicsActor");
+	physicsOverlapPreset = FCollisionPreset::Find("PhysicsActorOverlap");
+
+	// Save the hand physics rotation relative to the hand root and precompute the collider states before it is detached by simulating physics.
+	originalPhysicsRotation = handPhysics->GetRelativeRotation().Quaternion();
+	BuildColliderStates();
+
+	// Only reduce the animation rate of the hand skel while it isn't rendered, visible hands are always close enough to update every frame.
+	if (handSkel->AnimUpdateRateParams) handSkel->AnimUpdateRateParams->BaseNonRenderedUpdateRate = hiddenAnimUpdateRate;
+
+	// Move the hand skel onto the visual root under the controller so it is late updated, the physics hand is detached from the controller once simulating.
+	if (lowLatencyVisuals)
+	{
+		controller->bDisableLowLatencyUpdate = false;
+		handVisual->SetRelativeTransform(handPhysics->GetRelativeTransform());
+		handSkel->AttachToComponent(handVisual, FAttachmentTransformRules::KeepRelativeTransform);
+		lastVisualTarget = handRoot->GetComponentTransform();
+	}
+
 	// Create a joint between the controller and hand.
 	handPhysics->SetSimulatePhysics(true);
 	handHandle->CreateJointAndFollowLocationWithRotation(handPhysics, (UPrimitiveComponent*)handRoot, NAME_None, handRoot->GetComponentLocation(), handRoot->GetComponentRotation());
@@ -142,6 +197,20 @@ void AVRHand::BeginPlay()
 	{
 		widgetOverlap->OnComponentBeginOverlap.AddDynamic(this, &AVRHand::WidgetInteractorOverlapBegin);
 	}
+
+	// Setup delegates for keeping track of the grab candidates overlapping the grab collider.
+	if (!grabCollider->OnComponentBeginOverlap.Contains(this, "GrabColliderOverlapBegin"))
+	{
+		grabCollider->OnComponentBeginOverlap.AddDynamic(this, &AVRHand::GrabColliderOverlapBegin);
+	}
+	if (!grabCollider->OnComponentEndOverlap.Contains(this, "GrabColliderOverlapEnd"))
+	{
+		grabCollider->OnComponentEndOverlap.AddDynamic(this, &AVRHand::GrabColliderOverlapEnd);
+	}
+
+	// Seed the grab candidates with anything that was already overlapping before the delegates were bound.
+	grabCollider->GetOverlappingComponents(grabCandidates);
+	candidatesChanged = true;
 }
 
 void AVRHand::SetupHand(AVRHand* oppositeHand, AVRPlayer* playerRef, bool dev)
@@ -164,6 +233,13 @@ void AVRHand::SetupHand(AVRHand* oppositeHand, AVRPlayer* playerRef, bool dev)
 
 	// Set up the controller offsets for the current type of controller selected.
 	if (!devModeEnabled) SetupControllerOffset();
+
+	// Tick after the players input snapshot and this frames controller pose, then update the physics handle targets from this frames hand.
+	AddTickPrerequisiteActor(player);
+	AddTickPrerequisiteComponent(controller);
+	handHandle->AddTickPrerequisiteActor(this);
+	grabHandle->AddTickPrerequisiteActor(this);
+	SetActorTickEnabled(true);
 }
 
 void AVRHand::SetControllerType(EVRController type)
@@ -192,22 +268,15 @@ void AVRHand::SetupControllerOffset()
 
 void AVRHand::Tick(float DeltaTime)
 {
+	if (!active) return;
 	Super::Tick(DeltaTime);
 
-	// Calculate controller velocity as its not simulating physics.
-	lastHandPosition = currentHandPosition;
-	currentHandPosition = controller->GetComponentLocation();
-	handVelocity = (currentHandPosition - lastHandPosition) / DeltaTime;
-	
-	// Calculate angular velocity for the controller for when its not simulating physics.
-	lastHandRotation = currentHandRotation;
-	currentHandRotation = controller->GetComponentQuat();
-	FQuat deltaRot = lastHandRotation.Inverse() * currentHandRotation;
-	FVector axis;
-	float angle;
-	deltaRot.ToAxisAndAngle(axis, angle);
-	angle = FMath::RadiansToDegrees(angle);
-	handAngularVelocity = currentHandRotation.RotateVector((axis * angle) / DeltaTime);
+	// Save the controllers pose and estimate its velocity from the recent poses as its not simulating physics.
+	poseHistory.AddSample(GetWorld()->GetTimeSeconds(), controller->GetComponentTransform());
+	poseHistory.EstimateVelocity(velocitySampleCount, handVelocity, handAngularVelocity);
+
+	// Update the late updated hand visual from the last physics step.
+	if (lowLatencyVisuals) UpdateVisualPose();
 
 	// Update finger tracking and physics collider size based off finger tracking.
 	UpdateFingerTracking();
@@ -216,7 +285,7 @@ void AVRHand::Tick(float DeltaTime)
 	if (objectInHand)
 	{
 		// Execute dragging for the grabbed object.
-		IInteractionInterface::Execute_Dragging(objectInHand, DeltaTime);
+		IInteractionInterface::Dispatch_Dragging(objectInHand, DeltaTime);
 
 		// Update interactable distance for releasing over max distance.
 		CheckInteractablesDistance();
@@ -233,14 +302,17 @@ void AVRHand::Tick(float DeltaTime)
 			{
 				UpdateTelekineticGrab();
 			}
-			else if (lerpingGrabbable)
+			else
 			{
-				lerpingGrabbable->grabbableMesh->SetCollisionProfileName("Interactable");
-				lerpingGrabbable->grabbableMesh->SetPhysicsLinearVelocity(FVector::ZeroVector);
-				lerpingGrabbable = nullptr;
-			}	
+				if (telekineticPulling) CancelTelekineticPull();
+
+				// Forget the last search so a new one starts when the fist is closed again.
+				if (telekineticSwept) ResetTelekineticSearch();
+			}
 		}
 	}
+
+	FVRTickTrace::Record(this, FVRTickTrace::EStage::HandUpdated);
 }
 
 void AVRHand::WidgetInteractorOverlapBegin(class UPrimitiveComponent* OverlappedComp, class AActor* OtherActor, class UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
@@ -251,14 +323,57 @@ void AVRHand::WidgetInteractorOverlapBegin(class UPrimitiveComponent* Overlapped
 		// Rotate the widget interactor to face what we have overlapped with and press then release the pointer key.
 		FVector worldDirection = widgetInteractor->GetComponentLocation() - SweepResult.Location;
 		widgetInteractor->SetWorldRotation(worldDirection.Rotation());
-		widgetInteractor->PressPointerKey(EKeys::LeftMouseButton);
-		widgetInteractor->ReleasePointerKey(EKeys::LeftMouseButton);
 
-		// Rumble the controller to give feedback that the button was successfully pressed.
-		PlayFeedback();
+		// The fast widget path optimizes away the world space widget paths needed for the press, so only use the legacy path for its duration.
+		{
+			TGuardValue<int32> legacyWidgetPath(GSlateFastWidgetPath, 0);
+			widgetInteractor->PressPointerKey(EKeys::LeftMouseButton);
+			widgetInteractor->ReleasePointerKey(EKeys::LeftMouseButton);
+		}
+
+		// Rumble the controller to give feedback that the button was successfully pressed. Takes priority over any continuous feedback.
+		PlayFeedback(nullptr, 1.0f, false, 1);
 	}
 }
 
+void AVRHand::GrabColliderOverlapBegin(class UPrimitiveComponent* OverlappedComp, class AActor* OtherActor, class UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+{
+	// Ignore components from this hand.
+	if (!OtherComp || OtherActor == this) return;
+
+	// Add the new candidate and re-pick the closest candidate next check.
+	grabCandidates.AddUnique(OtherComp);
+	candidatesChanged = true;
+}
+
+void AVRHand::GrabColliderOverlapEnd(class UPrimitiveComponent* OverlappedComp, class AActor* OtherActor, class UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+{
+	// Remove the candidate and its cached interface owner and re-pick the closest candidate next check.
+	if (grabCandidates.RemoveSingleSwap(OtherComp) > 0) candidatesChanged = true;
+	interfaceOwnerCache.Remove(FObjectKey(OtherComp));
+}
+
+void AVRHand::InvalidateInterfaceCache()
+{
+	interfaceCacheGeneration++;
+}
+
+void AVRHand::SetComponentGrabbable(UActorComponent* comp, bool grabbable)
+{
+	if (!comp) return;
+	if (grabbable) comp->ComponentTags.AddUnique(FName("Grabbable"));
+	else comp->ComponentTags.Remove(FName("Grabbable"));
+	InvalidateInterfaceCache();
+}
+
+void AVRHand::SetActorGrabbable(AActor* actor, bool grabbable)
+{
+	if (!actor) return;
+	if (grabbable) actor->Tags.AddUnique(FName("Grabbable"));
+	else actor->Tags.Remove(FName("Grabbable"));
+	InvalidateInterfaceCache();
+}
+
 void AVRHand::TriggerPressed()
 {
 	// Implement dev mode grabbing...
@@ -297,7 +412,7 @@ void AVRHand::Grab()
 		// Release the actor from the other hand if it has the objectToGrab grabbed and the grabbed object does NOT support two handed grabbing.
 		if (otherHand && objectToGrab == otherHand->objectInHand)
 		{
-			FInterfaceSettings otherGrabbedObjectSettings = IInteractionInterface::Execute_GetInterfaceSettings(otherHand->objectInHand);
+			FInterfaceSettings otherGrabbedObjectSettings = IInteractionInterface::Dispatch_GetInterfaceSettings(otherHand->objectInHand);
 			if (!otherGrabbedObjectSettings.twoHandedGrabbing) otherHand->ReleaseGrabbedActor();
 		}
 
@@ -308,11 +423,11 @@ void AVRHand::Grab()
 		
 		// Update grabbed variables.
 		objectInHand = objectToGrab;
-		IInteractionInterface::Execute_Grabbed(objectInHand, this);
-		IInteractionInterface::Execute_EndOverlapping(objectInHand, this);
+		IInteractionInterface::Dispatch_Grabbed(objectInHand, this);
+		IInteractionInterface::Dispatch_EndOverlapping(objectInHand, this);
 
-		// Feedback to indicate the object has been grabbed.
-		PlayFeedback(); 
+		// Feedback to indicate the object has been grabbed. Takes priority over any continuous feedback.
+		PlayFeedback(nullptr, 1.0f, false, 1);
 	}
 }
 
@@ -351,7 +466,7 @@ void AVRHand::Interact(bool pressed)
 {
 	if (objectInHand)
 	{
-		IInteractionInterface::Execute_Interact(objectInHand, pressed);
+		IInteractionInterface::Dispatch_Interact(objectInHand, pressed);
 	}
 }
 
@@ -361,11 +476,13 @@ void AVRHand::ReleaseGrabbedActor()
  	if (objectInHand)
 	{	
 		// Execute release interactable.
-		IInteractionInterface::Execute_Released(objectInHand, this);
+		IInteractionInterface::Dispatch_Released(objectInHand, this);
 
-		// Nullify grabbed objects variables.
+		// Nullify grabbed objects variables and re-pick the closest grab candidate on the next check.
+		if (heldVisualSource.IsValid()) SetHeldVisual(nullptr);
 		objectInHand = nullptr;
 		objectToGrab = nullptr;
+		candidatesChanged = true;
 
 		// Show the hands if they are hidden and start checking the hands collision in 0.4f seconds to be re-enabled.
 		if (hideOnGrab) handSkel->SetVisibility(true);	
@@ -378,7 +495,7 @@ void AVRHand::Squeeze(float howHard)
 	// Execute the interactables grip pressed and released functions.
  	if (objectInHand)
  	{
- 		IInteractionInterface::Execute_Squeezing(objectInHand, this, howHard);
+ 		IInteractionInterface::Dispatch_Squeezing(objectInHand, this, howHard);
  	}
 }
 
@@ -389,8 +506,14 @@ void AVRHand::TeleportHand()
 	if (objectInHand) grabHandle->TeleportGrabbedComp();
 	ResetCollision();
 
+	// Clear the pose history so the teleport isn't seen as hand velocity.
+	poseHistory.Reset();
+
+	// Drop the physics hands offset to its old target so the visual doesn't follow it across the teleport.
+	lastVisualTarget = handRoot->GetComponentTransform();
+
 	// Used on components that need re-positioning after a teleportation.
-	if (objectInHand) IInteractionInterface::Execute_Teleported(objectInHand);
+	if (objectInHand) IInteractionInterface::Dispatch_Teleported(objectInHand);
 }
 
 void AVRHand::UpdateControllerTrackedState()
@@ -405,7 +528,7 @@ void AVRHand::UpdateControllerTrackedState()
 #endif
 
 	// Only allow the collision on this hand to be enabled if the controller is being tracked.
-	bool trackingController = controller->IsTracked();
+	bool trackingController = player && player->inputSnapshot.GetHand(handEnum).tracked;
 	if (trackingController)
 	{
 		if (!foundController)
@@ -429,43 +552,43 @@ void AVRHand::UpdateControllerTrackedState()
 
 void AVRHand::CheckForOverlappingActors()
 {
-	// Get grabColliders current overlapping components.
-	TArray<UPrimitiveComponent*> overlapping;
-	grabCollider->GetOverlappingComponents(overlapping);
+	// Make sure the current object to grab hasn't been deactivated since it was picked, if it has re-pick the closest candidate.
+	if (objectToGrab && !IInteractionInterface::Dispatch_GetInterfaceSettings(objectToGrab).active) candidatesChanged = true;
+
+	// Only re-pick the closest candidate if the candidates have changed or the hand has moved far enough to change the result.
+	FVector grabColliderLocation = grabCollider->GetComponentLocation();
+	if (!candidatesChanged && FVector::DistSquared(grabColliderLocation, lastCandidateCheckLocation) < FMath::Square(candidateUpdateDistance)) return;
+	lastCandidateCheckLocation = grabColliderLocation;
+	candidatesChanged = false;
+
 	UObject* toGrab = nullptr;
 	float smallestDistance = 100000.0f;
 
-	// If components are found.
-	if (overlapping.Num() > 0)
+	// Loop through each grab candidate and find the closest one with an interface. Removing any that have been destroyed.
+	for (int i = grabCandidates.Num() - 1; i >= 0; i--)
 	{
-		// Loop through each overlapping component and find the closest one with an interface.
-		for (UPrimitiveComponent* comp : overlapping)
+		UPrimitiveComponent* comp = grabCandidates[i];
+		if (!comp || comp->IsPendingKill())
+		{
+			interfaceOwnerCache.Remove(FObjectKey(comp));
+			grabCandidates.RemoveAtSwap(i);
+			continue;
+		}
+
+		// If a object with an interface has been found.
+		UObject* objectWithInterface = LookForInterface(comp);
+		if (objectWithInterface)
 		{
-			// If a object with an interface has been found.
-			UObject* objectWithInterface = LookForInterface(comp);
-			if (objectWithInterface)
+			// Make sure this interface is currently allowing interaction, otherwise go to the next candidate.
+			FInterfaceSettings objectsInterfaceSettings = IInteractionInterface::Dispatch_GetInterfaceSettings(objectWithInterface);
+			if (!objectsInterfaceSettings.active) continue;
+
+			// Update the closest component and smallest distance value to compare to the next component in the array.
+			float currentDistance = (comp->GetComponentLocation() - grabColliderLocation).Size();
+			if (currentDistance < smallestDistance)
 			{
-				// Make sure this interface is currently allowing interaction.
-				FInterfaceSettings objectsInterfaceSettings = IInteractionInterface::Execute_GetInterfaceSettings(objectWithInterface);
-				if (!objectsInterfaceSettings.active)
-				{
-					// End overlapping before exiting this function.
-					if (objectToGrab)
-					{
-						IInteractionInterface::Execute_EndOverlapping(objectToGrab, this);
-						objectToGrab = nullptr;
-					}
-					// Go to next item in the overlapping array.
-					continue;
-				}
-
-				// Update the closest component and smallest distance value to compare to the next component in the array.
-				float currentDistance = (comp->GetComponentLocation() - grabCollider->GetComponentLocation()).Size();
-				if (currentDistance < smallestDistance)
-				{
-					smallestDistance = currentDistance;
-					toGrab = objectWithInterface;
-				}
+				smallestDistance = currentDistance;
+				toGrab = objectWithInterface;
 			}
 		}
 	}
@@ -476,7 +599,7 @@ void AVRHand::CheckForOverlappingActors()
 		// If there was an object To Grab end overlapping. (Un-Highlight)
 		if (objectToGrab)
 		{
-			IInteractionInterface::Execute_EndOverlapping(objectToGrab, this);
+			IInteractionInterface::Dispatch_EndOverlapping(objectToGrab, this);
 			objectToGrab = nullptr;
 		}
 
@@ -484,41 +607,52 @@ void AVRHand::CheckForOverlappingActors()
 		if (toGrab)
 		{
 			objectToGrab = toGrab;
-			IInteractionInterface::Execute_Overlapping(objectToGrab, this);
+			IInteractionInterface::Dispatch_Overlapping(objectToGrab, this);
 		}
 	}
 }
 
 UObject* AVRHand::LookForInterface(USceneComponent* comp)
+{
+	if (!comp) return nullptr;
+
+	// Use the cached interface owner if nothing has been attached, detached, destroyed or re-tagged since it was found.
+	FObjectKey compKey(comp);
+	if (FInterfaceOwnerCache* cachedOwner = interfaceOwnerCache.Find(compKey))
+	{
+		if (cachedOwner->IsValid(interfaceCacheGeneration)) return cachedOwner->interfaceOwner.Get();
+	}
+
+	// Otherwise find the interface owner and cache the result.
+	UObject* interfaceOwner = FindInterfaceOwner(comp);
+	interfaceOwnerCache.Add(compKey, FInterfaceOwnerCache(interfaceOwner, interfaceCacheGeneration));
+	return interfaceOwner;
+}
+
+UObject* AVRHand::FindInterfaceOwner(USceneComponent* comp)
 {
 	// Check the component for the interface then work way up each parent until one is found. If not return null.
 	bool componentHasTag = comp->ComponentHasTag("Grabbable");
-	bool componentHasInterface = comp->GetClass()->ImplementsInterface(UInteractionInterface::StaticClass());
+	bool componentHasInterface = IInteractionInterface::ClassImplementsInterface(comp->GetClass());
 	if (componentHasInterface) return comp;
 	else
 	{
 		// Check components actor for the interface before searching through its parents.
-		bool actorHasTag = comp->GetOwner()->ActorHasTag(FName("Grabbable"));
-		bool actorHasInterface = comp->GetOwner()->GetClass()->ImplementsInterface(UInteractionInterface::StaticClass());
-		if (actorHasInterface && (actorHasTag || componentHasTag)) return comp->GetOwner();
+		AActor* compOwner = comp->GetOwner();
+		bool actorHasTag = compOwner && compOwner->ActorHasTag(FName("Grabbable"));
+		bool actorHasInterface = compOwner && IInteractionInterface::ClassImplementsInterface(compOwner->GetClass());
+		if (actorHasInterface && (actorHasTag || componentHasTag)) return compOwner;
 		// If the components actor doest have the interface and has a parent component look for interface here.
 		else if (comp->GetAttachParent())
 		{
 			// Look through each parent in order from bottom to top, then if nothing is found check the actor itself.
-			bool searching = true;
 			USceneComponent* parentComponent = comp->GetAttachParent();
-			while (searching)
+			while (parentComponent)
 			{
-				bool parentHasInterface = parentComponent->GetClass()->ImplementsInterface(UInteractionInterface::StaticClass());
 				// If the parent has the interface and is grabbable use this component.
-				if (parentHasInterface)
-				{
-					return parentComponent;
-					searching = false;
-				}
-				else if (parentComponent->GetAttachParent()) parentComponent = parentComponent->GetAttachParent();
+				if (IInteractionInterface::ClassImplementsInterface(parentComponent->GetClass())) return parentComponent;
 				// If there are no more attach parents exit the while loop.
-				else searching = false;
+				parentComponent = parentComponent->GetAttachParent();
 			}
 		}
 	}
@@ -530,7 +664,7 @@ void AVRHand::CheckInteractablesDistance()
 	if (objectInHand)
 	{
 		// Get the grabbed objects interface settings.
-		FInterfaceSettings grabbedObjectSettings = IInteractionInterface::Execute_GetInterfaceSettings(objectInHand);
+		FInterfaceSettings grabbedObjectSettings = IInteractionInterface::Dispatch_GetInterfaceSettings(objectInHand);
 
 		// Get required variables from the current grabbed objects interface.
 		float currentHandGrabDistance = grabbedObjectSettings.handDistance;
@@ -578,13 +712,88 @@ void AVRHand::UpdateFingerTracking()
 		openedSinceGrabbed = true;
 	}
 
-	// Update the boxes extent and positioning for when the hand is closed or opened. 
+	// Update the boxes extent and positioning for when the hand is closed or opened.
+	UpdateColliderState();
+}
+
+void AVRHand::BuildColliderStates()
+{
+	// Precompute each state between open and closed.
 	// NOTE: This is overcomplicated because of the way the handskel is attached to the physics box.
-	float grabExtentX = FMath::Lerp(9.5f, 4.0f, fingersClosedAlpha);
-	handPhysics->SetBoxExtent(FVector(grabExtentX, 2.9f, 5.6f));
-	FVector newOffset = handPhysics->GetForwardVector() * (fingersClosedAlpha * -4.0f);
-	handHandle->SetLocationOffset(newOffset);
-	handSkel->SetRelativeLocation(originalSkelOffset + FVector(fingersClosedAlpha * 4.0f, 0.0f, 0.0f));
+	int32 stateCount = FMath::Max(colliderStateCount, 2);
+	colliderStates.SetNum(stateCount);
+	for (int i = 0; i < stateCount; i++)
+	{
+		float stateAlpha = (float)i / (float)(stateCount - 1);
+		FHandColliderState& state = colliderStates[i];
+		state.boxExtent = FVector(FMath::Lerp(9.5f, 4.0f, stateAlpha), 2.9f, 5.6f);
+		state.handleOffset = originalPhysicsRotation.RotateVector(FVector(stateAlpha * -4.0f, 0.0f, 0.0f));
+		state.skelOffset = FVector(stateAlpha * 4.0f, 0.0f, 0.0f);
+	}
+	currentColliderState = -1;
+}
+
+void AVRHand::UpdateColliderState()
+{
+	if (colliderStates.Num() < 2) return;
+
+	// Find the closest state to the fingers closed alpha. If it is not the current state only change if the alpha has moved past the hysteresis from the current state.
+	// The hysteresis is kept under half a state so the neighbouring state can always be reached, and the end states are always reached once fully open or closed.
+	float stateSize = 1.0f / (float)(colliderStates.Num() - 1);
+	int32 lastState = colliderStates.Num() - 1;
+	int32 newState = FMath::Clamp(FMath::RoundToInt(fingersClosedAlpha / stateSize), 0, lastState);
+	if (newState == currentColliderState) return;
+	float hysteresis = FMath::Clamp(colliderStateHysteresis, 0.0f, stateSize * 0.49f);
+	bool reachedEnd = (newState == 0 && fingersClosedAlpha <= 0.0f) || (newState == lastState && fingersClosedAlpha >= 1.0f);
+	if (currentColliderState != -1 && !reachedEnd && FMath::Abs(fingersClosedAlpha - (currentColliderState * stateSize)) < (stateSize * 0.5f) + hysteresis) return;
+
+	// Apply the new state.
+	const FHandColliderState& state = colliderStates[newState];
+	handPhysics->SetBoxExtent(state.boxExtent);
+	handHandle->SetLocalLocationOffset(state.handleOffset);
+	handSkel->SetRelativeLocation(originalSkelOffset + state.skelOffset);
+	currentColliderState = newState;
+}
+
+void AVRHand::UpdateVisualPose()
+{
+	// Keep the physics hands offset from the target it was driven towards on the last step, applied to this frames target.
+	// NOTE: This reconciles the visual with the physics hand every step, e.g. when the physics hand is blocked by a wall.
+	FTransform physicsPose = handPhysics->GetComponentTransform();
+	handVisual->SetRelativeTransform(physicsPose.GetRelativeTransform(lastVisualTarget));
+	lastVisualTarget = handRoot->GetComponentTransform();
+
+	// Render the grabbable held by this hand from the visual root with its offset from the physics hand on the last step, reconciling it with
+	// its simulated body every step. When held with two hands only the first renders it.
+	UStaticMeshComponent* heldMesh = nullptr;
+	AGrabbableActor* heldGrabbable = Cast<AGrabbableActor>(objectInHand);
+	if (heldGrabbable && heldGrabbable->grabInfo.handRef == this) heldMesh = heldGrabbable->grabbableMesh;
+	if (heldMesh != heldVisualSource.Get()) SetHeldVisual(heldMesh);
+	if (heldMesh) heldVisual->SetRelativeTransform(heldMesh->GetComponentTransform().GetRelativeTransform(physicsPose));
+}
+
+void AVRHand::SetHeldVisual(UStaticMeshComponent* heldMesh)
+{
+	// Show the last held mesh again.
+	if (UStaticMeshComponent* lastHeldMesh = heldVisualSource.Get()) lastHeldMesh->SetVisibility(heldVisualSourceVisible);
+	heldVisualSource = heldMesh;
+	heldVisual->EmptyOverrideMaterials();
+	if (!heldMesh)
+	{
+		heldVisual->SetVisibility(false);
+		heldVisual->SetStaticMesh(nullptr);
+		return;
+	}
+
+	// Copy the mesh and its materials then hide the original.
+	heldVisual->SetStaticMesh(heldMesh->GetStaticMesh());
+	for (int32 i = 0; i < heldMesh->GetNumMaterials(); i++)
+	{
+		heldVisual->SetMaterial(i, heldMesh->GetMaterial(i));
+	}
+	heldVisual->SetVisibility(heldMesh->IsVisible());
+	heldVisualSourceVisible = heldMesh->IsVisible();
+	heldMesh->SetVisibility(false);
 }
 
 void AVRHand::UpdateAnimationInstance()
@@ -614,11 +823,9 @@ void AVRHand::UpdateAnimationInstance()
 		}
 #endif
 
-		// Update anim instances finger curls.
-		EHand hand = handEnum == EControllerHand::Left ? EHand::VR_LeftHand : EHand::VR_RightHand;
-		FSteamVRFingerCurls curls;
-		FSteamVRFingerSplays splays;
-		USteamVRInputDeviceFunctionLibrary::GetFingerCurlsAndSplays(hand, curls, splays, ESkeletalSummaryDataType::VR_SummaryType_FromDevice);
+		// Update anim instances finger curls from this frames input snapshot.
+		if (!player) return;
+		const FSteamVRFingerCurls& curls = player->inputSnapshot.GetHand(handEnum).curls;
 
 		// Update animation variables.
 		handAnim->fingerClosingAmount = curls.Index;
@@ -633,52 +840,160 @@ void AVRHand::UpdateAnimationInstance()
 void AVRHand::UpdateTelekineticGrab()
 {
 	// Look for lerping grabbable.
-	if (!lerpingGrabbable)
-	{
-		FHitResult sweepResult;
-		FVector startLoc = handPhysics->GetComponentLocation();
-		FVector endLoc = startLoc + (handPhysics->GetForwardVector() * 1000.0f);
-		TArray<TEnumAsByte<EObjectTypeQuery>> grabbableTypes;
-		grabbableTypes.Add(UEngineTypes::ConvertToObjectType(ECC_Interactable));
-		GetWorld()->SweepSingleByObjectType(sweepResult, startLoc, endLoc, FQuat::Identity, grabbableTypes, FCollisionShape::MakeSphere(15.0f));
-		if (sweepResult.bBlockingHit)
+	if (!telekineticPulling)
+	{
+		// Start pulling the grabbable found by the last sweep if it hasn't since been taken by the other hand.
+		AGrabbableActor* foundGrabbable = telekineticTarget.Get();
+		telekineticTarget = nullptr;
+		if (foundGrabbable && otherHand->objectInHand != foundGrabbable && otherHand->lerpingGrabbable != foundGrabbable)
 		{
-			if (AGrabbableActor* isGrabbable = Cast<AGrabbableActor>(sweepResult.Actor))
-			{
-				if (otherHand->objectInHand == isGrabbable) return;
-				lerpingGrabbable = isGrabbable;
-				lerpingGrabbable->grabbableMesh->SetCollisionProfileName("PhysicsActorOverlap");
-				FVector foundLocation = lerpingGrabbable->grabbableMesh->GetComponentLocation();
-				telekineticStartLoc = foundLocation;
-				telekineticStartTime = GetWorld()->GetTimeSeconds();
-				telekineticLerpSpeed = (FMath::Clamp((foundLocation - controller->GetComponentLocation()).Size(), 0.0f, 1000.0f) / 1000.0f) * 1.5f;
-				return;
-			}
+			lerpingGrabbable = foundGrabbable;
+			telekineticPulling = true;
+			FVector foundLocation = lerpingGrabbable->grabbableMesh->GetComponentLocation();
+			telekineticStartLoc = foundLocation;
+			telekineticStartRot = lerpingGrabbable->grabbableMesh->GetComponentQuat();
+
+			// Drive the grabbable along the pull with the grab handles kinematic target so it is simulated rather than teleported.
+			// Disable the hands collision while pulling so the grabbable isn't pushed away by the hand as it arrives.
+			grabHandle->CreateJointAndFollowLocationWithRotation(lerpingGrabbable->grabbableMesh, NAME_None, foundLocation, telekineticStartRot.Rotator(), telekineticPullData);
+			ActivateCollision(false);
+			telekineticStartTime = GetWorld()->GetTimeSeconds();
+			telekineticLerpSpeed = (FMath::Clamp((foundLocation - controller->GetComponentLocation()).Size(), 0.0f, telekineticRange) / telekineticRange) * 1.5f;
+			ResetTelekineticSearch();
+			return;
+		}
+
+		// Wait for the sweep in flight to return.
+		if (telekineticTrace.IsValid()) return;
+
+		// Pre-filter this worlds registered grabbables by the telekinetic cone, widened by each grabbables bounds and the sweep radius.
+		UGrabbableSubsystem* registry = GetWorld()->GetSubsystem<UGrabbableSubsystem>();
+		if (!registry) return;
+		FVector aimLocation = handPhysics->GetComponentLocation();
+		FVector aimDirection = handPhysics->GetForwardVector();
+		float coneTan = FMath::Tan(FMath::DegreesToRadians(FMath::Clamp(telekineticConeAngle, 0.0f, 89.0f)));
+		float sweepLength = 0.0f;
+		bool candidateMoving = false;
+		TArray<TWeakObjectPtr<AGrabbableActor>> candidates;
+		for (const TWeakObjectPtr<AGrabbableActor>& registeredGrabbable : registry->GetGrabbables())
+		{
+			AGrabbableActor* candidate = registeredGrabbable.Get();
+			if (!candidate || otherHand->objectInHand == candidate || otherHand->lerpingGrabbable == candidate) continue;
+			if (!candidate->grabbableMesh->IsSimulatingPhysics()) continue;
+
+			// Check the candidate is in front of the hand, in range and inside the cone.
+			FVector toCandidate = candidate->grabbableMesh->GetComponentLocation() - aimLocation;
+			float alongAim = FVector::DotProduct(toCandidate, aimDirection);
+			float candidateRadius = candidate->grabbableMesh->Bounds.SphereRadius + 15.0f;
+			if (alongAim <= 0.0f || alongAim - candidateRadius > telekineticRange) continue;
+			float offAim = (toCandidate - (aimDirection * alongAim)).Size();
+			if (offAim > (alongAim * coneTan) + candidateRadius) continue;
+
+			// Add the candidate and extend the sweep to reach it.
+			candidates.Add(candidate);
+			sweepLength = FMath::Max(sweepLength, FMath::Min(alongAim + candidateRadius, telekineticRange));
+			if (candidate->grabbableMesh->RigidBodyIsAwake()) candidateMoving = true;
 		}
+
+		// Nothing inside the cone so there is nothing for a sweep to find.
+		if (candidates.Num() == 0)
+		{
+			ResetTelekineticSearch();
+			return;
+		}
+
+		// Hold the result of the last sweep while the aim hasn't changed and the same candidates are still resting inside the cone.
+		bool aimChanged = !aimLocation.Equals(telekineticAimLocation, 1.0f) || !aimDirection.Equals(telekineticAimDirection, 0.01f);
+		if (telekineticSwept && !aimChanged && !candidateMoving && candidates == telekineticCandidates) return;
+
+		// Sweep for the first interactable along the aim, the result is consumed on the next update.
+		FTraceDelegate sweepDelegate = FTraceDelegate::CreateUObject(this, &AVRHand::TelekineticSweepFinished);
+		FCollisionQueryParams sweepParams(SCENE_QUERY_STAT(TelekineticGrab));
+		sweepParams.AddIgnoredActor(this);
+		sweepParams.AddIgnoredActor(otherHand);
+		if (player) sweepParams.AddIgnoredActor(player);
+		FVector endLoc = aimLocation + (aimDirection * sweepLength);
+		telekineticTrace = GetWorld()->AsyncSweepByObjectType(EAsyncTraceType::Single, aimLocation, endLoc, FQuat::Identity, FCollisionObjectQueryParams(ECC_Interactable), FCollisionShape::MakeSphere(15.0f), sweepParams, &sweepDelegate);
+		telekineticAimLocation = aimLocation;
+		telekineticAimDirection = aimDirection;
+		telekineticCandidates = MoveTemp(candidates);
+		telekineticSwept = true;
 	}
 	// Otherwise lerp the grabbable to the hand.
 	else
 	{
-		float alpha = (GetWorld()->GetTimeSeconds() - telekineticStartTime) / telekineticLerpSpeed;
+		// Stop pulling if the grabbable has been destroyed or the other hand has grabbed it.
+		if (!IsValid(lerpingGrabbable) || otherHand->objectInHand == lerpingGrabbable)
+		{
+			CancelTelekineticPull();
+			return;
+		}
+
+		// Move the grab handles target along the pull, the joint drive moves the grabbable at physics rate.
+		float alpha = FMath::Clamp((GetWorld()->GetTimeSeconds() - telekineticStartTime) / telekineticLerpSpeed, 0.0f, 1.0f);
 		FVector endLocation = grabCollider->GetComponentLocation() + (grabCollider->GetRightVector() * (handEnum == EControllerHand::Left ? 8.0f : -8.0f));
 		FVector lerpingLocation = FMath::Lerp(telekineticStartLoc, endLocation, alpha);
-		lerpingGrabbable->grabbableMesh->SetWorldLocation(lerpingLocation, false, nullptr, ETeleportType::ResetPhysics);
-		lerpingGrabbable->grabbableMesh->SetPhysicsLinearVelocity(FVector::ZeroVector);
+		grabHandle->SetTarget(FTransform(telekineticStartRot, lerpingLocation), true);
 		if (alpha >= 1.0f)
 		{
-			// Reset interactable settings before grabbing.
-			lerpingGrabbable->grabbableMesh->SetCollisionProfileName("Interactable");
-			lerpingGrabbable->grabbableMesh->SetPhysicsLinearVelocity(FVector::ZeroVector);
-
-			// Grab the grabbable.
+			// Grab the grabbable, the grabbable will retarget the existing joint to the hand.
 			ForceGrab(lerpingGrabbable);
 
-			// Finished lerping.
-			lerpingGrabbable = nullptr;
+			// Finished lerping. Release the pull joint if the grab didn't happen.
+			if (objectInHand != lerpingGrabbable) CancelTelekineticPull();
+			else
+			{
+				lerpingGrabbable = nullptr;
+				telekineticPulling = false;
+			}
+		}
+	}
+}
+
+void AVRHand::TelekineticSweepFinished(const FTraceHandle& handle, FTraceDatum& data)
+{
+	// Ignore sweeps that were issued before the search was reset.
+	if (handle != telekineticTrace) return;
+	telekineticTrace = FTraceHandle();
+
+	// Store the grabbable that was hit, if any, to be pulled on the next update.
+	// Only accept candidates from the cone that are still simulating, anything else blocking the aim such as a snapped grabbable is ignored.
+	for (const FHitResult& hit : data.OutHits)
+	{
+		if (hit.bBlockingHit)
+		{
+			AGrabbableActor* hitGrabbable = Cast<AGrabbableActor>(hit.GetActor());
+			if (hitGrabbable && telekineticCandidates.Contains(hitGrabbable) && hitGrabbable->grabbableMesh->IsSimulatingPhysics()) telekineticTarget = hitGrabbable;
+			break;
 		}
 	}
 }
 
+void AVRHand::ResetTelekineticSearch()
+{
+	telekineticTrace = FTraceHandle();
+	telekineticTarget = nullptr;
+	telekineticCandidates.Reset();
+	telekineticSwept = false;
+}
+
+void AVRHand::CancelTelekineticPull()
+{
+	// Release the pull joint and stop the grabbable where it is.
+	if (IsValid(lerpingGrabbable))
+	{
+		if (grabHandle->grabbedComponent == lerpingGrabbable->grabbableMesh) grabHandle->DestroyJoint();
+		lerpingGrabbable->grabbableMesh->SetPhysicsLinearVelocity(FVector::ZeroVector);
+	}
+	// If the grabbable was destroyed mid pull only the joint is left to release.
+	else if (!IsValid(grabHandle->grabbedComponent)) grabHandle->DestroyJoint();
+	lerpingGrabbable = nullptr;
+	telekineticPulling = false;
+
+	// Re-enable the hands collision once the grabbable has had time to fall out of the way.
+	ActivateCollision(true, 0.6f);
+}
+
 void AVRHand::ResetHandle(UVRPhysicsHandleComponent* handleToReset)
 {
 	CHECK_RETURN(LogHand, !handleToReset, "The hand class %s, cannot reset a null handle in the ResetPhysicsHandle function.");
@@ -694,23 +1009,21 @@ void AVRHand::ResetCollision()
 
 void AVRHand::ActivateCollision(bool enable, float enableDelay)
 {
-	if (handSkel)
+	if (handSkel && player)
 	{
 		// When the hand is open allow all collision to be enabled after a delay while interactables fall out of the way.
 		if (enable)
 		{
-			FTimerDelegate timerDel;
-			timerDel.BindUFunction(this, FName("CollisionDelay"));
-			GetWorldTimerManager().SetTimer(colTimerHandle, timerDel, 0.1f, true, enableDelay);
+			player->collisionClearance->WaitForClearance(handPhysics, player->actorsToIgnore, FComponentCleared::CreateUObject(this, &AVRHand::HandCollisionCleared), enableDelay);
 			collisionEnabled = true;
 		}
 		// Disable collision while the hand is closed to prevent accidental interactions.
 		else
 		{
 			handSkel->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-			handPhysics->SetCollisionProfileName("PhysicsActorOverlap");
+			physicsOverlapPreset.ApplyTo(handPhysics);
 			collisionEnabled = false;
-			GetWorldTimerManager().ClearTimer(colTimerHandle);
+			player->collisionClearance->CancelClearance(handPhysics);
 		}
 
 #if WITH_EDITOR
@@ -720,52 +1033,27 @@ void AVRHand::ActivateCollision(bool enable, float enableDelay)
 	}
 }
 
-void AVRHand::CollisionDelay()
+void AVRHand::HandCollisionCleared(UPrimitiveComponent* clearedComp)
 {
-	// Only re-enable the collision if the handSkel is no longer overlapping anything.
-	TArray<UPrimitiveComponent*> overlappingComps;
-	bool overlapping = UVRFunctionLibrary::ComponentOverlapComponentsByChannel(handPhysics, handPhysics->GetComponentTransform(), ECC_PhysicsBody, player->actorsToIgnore, overlappingComps, true);
-
-	// If no longer overlapping any blocking collision to the hand.
-	if (!overlapping)
-	{
-		// Re-enable collision in this classes colliding components.
-		handSkel->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
-		handPhysics->SetCollisionProfileName("PhysicsActor");
-
-		// End this function loop.
-		GetWorld()->GetTimerManager().ClearTimer(colTimerHandle);
-	}
+	// Re-enable collision in this classes colliding components.
+	handSkel->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+	physicsPreset.ApplyTo(handPhysics);
 }
 
-bool AVRHand::PlayFeedback(UHapticFeedbackEffect_Base* feedback, float intensity, bool replace)
+bool AVRHand::PlayFeedback(UHapticFeedbackEffect_Base* feedback, float intensity, bool replace, int32 priority)
 {
-	if (owningController)
+	if (player)
 	{
-		// Check if should replace feedback effect. If don't replace, still playing and the new intensity is weaker don't play haptic effect.
-		bool shouldPlay = replace ? true : (IsPlayingFeedback() ? GetCurrentFeedbackIntensity() < intensity : true);
-
-		// If should play then play the given feedback haptic effect on this hand classes controller.
-		if (shouldPlay)
-		{
-			// If feedback is null use default haptic feedback otherwise use the feedback pointer passed into this function.
-			UHapticFeedbackEffect_Base* feedbackToUse = feedback;
-			if (!feedbackToUse) feedbackToUse = GetEffects()->GetFeedback("Default");
+		// If feedback is null use default haptic feedback otherwise use the feedback pointer passed into this function.
+		UHapticFeedbackEffect_Base* feedbackToUse = feedback;
+		if (!feedbackToUse) feedbackToUse = GetEffects()->GetFeedback("Default");
 
-			// Play the given haptic effect if not nullptr.
-			if (feedbackToUse)
-			{
-				currentHapticIntesity = intensity;
-				owningController->PlayHapticEffect(feedbackToUse, handEnum, intensity, false);
-				return true;
-			}
-			else return false;
-		}
-		else return false;
+		// Submit the haptic effect to be merged with any other feedback requested for this hand classes controller this frame.
+		return player->hapticScheduler->SubmitFeedback(handEnum, feedbackToUse, intensity, replace, priority);
 	}	
 	else
 	{
-	    UE_LOG(LogHand, Log, TEXT("PlayFeedback: The feedback could not be played as the refference to the owning controller has been lost in the hand class %s."), *GetName());
+	    UE_LOG(LogHand, Log, TEXT("PlayFeedback: The feedback could not be played as the refference to the owning player has been lost in the hand class %s."), *GetName());
 		return false;
 	}
 }
@@ -778,21 +1066,22 @@ UEffectsContainer* AVRHand::GetEffects()
 
 float AVRHand::GetCurrentFeedbackIntensity()
 {
-	if (IsPlayingFeedback()) return currentHapticIntesity;
+	if (player) return player->hapticScheduler->GetCurrentFeedbackIntensity(handEnum);
 	else return 0.0f;
 }
 
 bool AVRHand::IsPlayingFeedback()
 {
-	bool isPlayingHapticEffect = false;
-	if (owningController)
-	{
-		if (handEnum == EControllerHand::Left && owningController->ActiveHapticEffect_Left.IsValid()) isPlayingHapticEffect = true;
-		else if (owningController->ActiveHapticEffect_Right.IsValid()) isPlayingHapticEffect = true;
-	}
-
 	// Return if this hand classes controller is playing a haptic effect.
-	return isPlayingHapticEffect;
+	if (player) return player->hapticScheduler->IsPlayingFeedback(handEnum);
+	else return false;
+}
+
+FTransform AVRHand::GetPredictedControllerTransform(float secondsAhead)
+{
+	// Use the current controller transform until there are poses to predict from.
+	if (poseHistory.Num() == 0) return controller->GetComponentTransform();
+	return poseHistory.PredictPose(poseHistory.GetSample(0).time + secondsAhead, velocitySampleCount);
 }
 
 void AVRHand::Disable(bool disable)
@@ -812,13 +1101,14 @@ void AVRHand::Disable(bool disable)
 	{
 		handSkel->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
 		grabCollider->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
-		handPhysics->SetCollisionProfileName("PhysicsActor");
+		physicsPreset.ApplyTo(handPhysics);
 	}
 	else
 	{
 		handSkel->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 		grabCollider->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-		handPhysics->SetCollisionProfileName("PhysicsActorOverlap");
+		physicsOverlapPreset.ApplyTo(handPhysics);
+		if (heldVisualSource.IsValid()) SetHeldVisual(nullptr);
 	}
 
 	// Disable this classes tick.
@@ -6,6 +6,10 @@
 #include "GameFramework/Actor.h"
 #include "Player/InteractionInterface.h"
 #include "SteamVRInputDevice/Public/SteamVRInputDeviceFunctionLibrary.h"
+#include "UObject/ObjectKey.h"
+#include "WorldCollision.h"
+#include "Project/PoseHistory.h"
+#include "Project/CollisionPresets.h"
 #include "Globals.h"
 #include "VRHand.generated.h"
 
@@ -22,6 +26,7 @@ class UBoxComponent;
 class UMotionControllerComponent;
 class UVRPhysicsHandleComponent;
 class USkeletalMeshComponent;
+class UStaticMeshComponent;
 class UHapticFeedbackEffect_Base;
 class UEffectsContainer;
 class UWidgetInteractionComponent;
@@ -39,6 +44,36 @@ enum class EVRController : uint8
 	Oculus
 };
 
+/** Cached result of looking for the interaction interface from a component, so the attachment hierarchy is only walked when something has changed.
+ * NOTE: Invalidated through AVRHand::InvalidateInterfaceCache whenever an interactable is attached, detached or destroyed or a "Grabbable" tag changes. */
+struct FInterfaceOwnerCache
+{
+	TWeakObjectPtr<UObject> interfaceOwner; /** The object that owns the interface, null if none was found. */
+	uint32 generation; /** The cache generation when resolved. */
+	bool foundOwner; /** Was an interface owner found. */
+
+	FInterfaceOwnerCache(UObject* owner = nullptr, uint32 currentGeneration = 0)
+	{
+		interfaceOwner = owner;
+		generation = currentGeneration;
+		foundOwner = owner != nullptr;
+	}
+
+	/** @Return true if this cached result is still valid. */
+	FORCEINLINE bool IsValid(uint32 currentGeneration) const
+	{
+		return generation == currentGeneration && (!foundOwner || interfaceOwner.IsValid());
+	}
+};
+
+/** Precomputed hand collider state for a quantized amount of closed fingers. */
+struct FHandColliderState
+{
+	FVector boxExtent; /** Extent of the hand physics box. */
+	FVector handleOffset; /** Offset of the hand handle in the handles target space. */
+	FVector skelOffset; /** Offset of the hand skeletal mesh from its original relative location. */
+};
+
 /** NOTE: Just flipping a mesh on an axis to create a left and right hand from the said mesh will break its physics asset in version UE4.23
  * NOTE: HandSkel collision used for interacting with grabbable etc. Constrained components must use physicsCollider to prevent constraint breakage. */
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
@@ -60,6 +95,14 @@ public:
 	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly)
 	USceneComponent* handRoot;
 
+	/** Visual root the handSkel is attached to while using low latency visuals. Follows the hand physics pose relative to the controller so it is late updated with it. */
+	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly)
+	USceneComponent* handVisual;
+
+	/** Copy of the held grabbables mesh under the visual root while using low latency visuals, so the held object is late updated with the hand. */
+	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly)
+	UStaticMeshComponent* heldVisual;
+
 	/** Hand simulated point in space for the handSkel to be attached to. */
 	UPROPERTY(VisibleDefaultsOnly, BlueprintReadWrite)
 	UBoxComponent* handPhysics;
@@ -129,10 +172,38 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hand")
 	bool telekineticGrab;
 
+	/** Maximum distance telekinetic grab will retrieve grabbables from. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hand")
+	float telekineticRange;
+
+	/** Half angle in degrees of the cone in front of the hand a grabbable must be inside before a telekinetic sweep is issued for it. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hand", meta = (ClampMin = "0.0", ClampMax = "90.0"))
+	float telekineticConeAngle;
+
+	/** Handle data used by the grab handle while pulling a grabbable towards the hand. NOTE: updateTargetLocation must be false as the target is set manually along the pull. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hand")
+	FPhysicsHandleData telekineticPullData;
+
 	/** Do the hands disappear when grabbing things? */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hand")
 	bool hideOnGrab;
 
+	/** Render the hand skeletal mesh with the controllers render thread late update instead of a frame behind with the physics hand. The physics hand,
+	 * grab handle targets and collisions stay on the game thread, the visual keeps any offset the physics hand has from its target on the last step.
+	 * NOTE: A held grabbable is rendered from heldVisual with its offset from the physics hand on the last step, so it stays in sync with the hand
+	 * while its simulated body stays on the game thread. Only the grabbables root mesh is copied. Set before begin play. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Hand")
+	bool lowLatencyVisuals;
+
+	/** Frames between animation updates of the hand skel while it is not rendered, e.g. hidden by hideOnGrab or off-screen. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Hand", meta = (ClampMin = "1", ClampMax = "30"))
+	int32 hiddenAnimUpdateRate;
+
+	/** Distance the grab collider has to move before the overlapping grab candidates are re-sorted to find the closest interactable.
+	 * NOTE: Changes in the overlapping candidates always cause a re-sort. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hand")
+	float candidateUpdateDistance;
+
 	/** Is the player grabbing? */
 	UPROPERTY(BlueprintReadOnly, Category = "Hand|CurrentValues")
 	bool grabbing;
@@ -145,6 +216,20 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "Hand|CurrentValues")
 	FVector handAngularVelocity;
 
+	/** The amount of precomputed collider states between the hand being open and closed. The hand physics is only resized when the fingers move into a new state. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hand", meta = (ClampMin = "2"))
+	int32 colliderStateCount;
+
+	/** How far past the edge of a collider state the fingers closed alpha must move before changing state. Prevents flickering between two states.
+	 * NOTE: Limited to just under half of a state when used, so every state stays reachable with a high colliderStateCount. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hand", meta = (ClampMin = "0.0", ClampMax = "0.5"))
+	float colliderStateHysteresis;
+
+	/** The amount of controller poses from the pose history used to estimate the hands velocity. Higher values are smoother but respond slower.
+	 * NOTE: Clamped to the size of the pose history. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hand", meta = (ClampMin = "2", ClampMax = "16"))
+	int32 velocitySampleCount;
+
 	/** Current trigger value used for animating the hands etc. */
 	UPROPERTY(BlueprintReadOnly, Category = "Hand|CurrentValues")
 	float trigger;
@@ -174,16 +259,27 @@ protected:
 private:
 
 	APlayerController* owningController; /** The owning player controller of this hand class. */
-	FTimerHandle colTimerHandle, controllerColTimerHandle; /** Timer handle to store a reference to the Collider timer that loops the function CollisionDelay to check for overlapping collision. */
 	FTransform originalHandTransform;/** Saved original hand transform at the end of initialization. */		
-	FQuat lastHandRotation, currentHandRotation;
-	FVector lastHandPosition, currentHandPosition;/** Last and current hand positions used for calculating force/velocity etc. */
+	FPoseHistory poseHistory; /** Timestamped controller poses used for calculating velocity and predicting the controllers pose. */
 	FVector originalSkelOffset;
+	FCollisionPreset physicsPreset, physicsOverlapPreset; /** Collision presets the hand physics switches between when its collision is enabled or disabled. */
+	FQuat originalPhysicsRotation; /** Relative rotation of the hand physics to the hand root before it started simulating. */
+	FTransform lastVisualTarget; /** Hand root transform the physics hand was driven towards on the last physics step. Used to find the physics hands offset from its target. */
+	TWeakObjectPtr<UStaticMeshComponent> heldVisualSource; /** The held grabbables mesh currently hidden and rendered from heldVisual. */
+	bool heldVisualSourceVisible; /** Was the held grabbables mesh visible before it was hidden. */
+	TArray<FHandColliderState> colliderStates; /** Precomputed collider states from open to closed. */
+	int32 currentColliderState; /** Index of the applied collider state, -1 if none has been applied. */
 	FVector telekineticStartLoc;
+	FQuat telekineticStartRot; /** Rotation of the grabbable when the telekinetic pull started, held by the grab handle along the pull. */
+	FVector telekineticAimLocation, telekineticAimDirection; /** Aim of the hand when the last telekinetic sweep was issued. */
+	FTraceHandle telekineticTrace; /** Handle of the async telekinetic sweep currently in flight. */
+	TWeakObjectPtr<AGrabbableActor> telekineticTarget; /** Grabbable hit by the last telekinetic sweep, pulled towards the hand on the next update. */
+	TArray<TWeakObjectPtr<AGrabbableActor>> telekineticCandidates; /** Grabbables inside the telekinetic cone when the last sweep was issued. */
+	bool telekineticSwept; /** Has a sweep been issued for the current aim and candidates, cleared when either of them change. */
+	bool telekineticPulling; /** Is a grabbable being pulled, stays set if the grabbable is destroyed mid pull until the pull joint is released. */
 
 	int distanceFrameCount; /** How many frames has the hand been too far away from the grabbed object. */
 	float devModeCurlAlpha; /** Curl alpha for all fingers while using dev mode... */
-	float currentHapticIntesity; /** The current playing haptic effects intensity for this hand classes controller. */
 	float telekineticStartTime;
 	float telekineticLerpSpeed;
 	float fingersClosedAlpha; /** Alpha reprisentation between 0 and 1 of how many fingers on this hand are closed. */
@@ -192,32 +288,72 @@ private:
 	bool devModeEnabled; /** Local bool to check if dev mode is enabled. */
 	bool openedSinceGrabbed; /** Has the hand been opened since the last intended grab action. */
 
+	UPROPERTY()
+	TArray<UPrimitiveComponent*> grabCandidates; /** Components currently overlapping the grab collider, updated from the grab colliders overlap events. */
+	TMap<FObjectKey, FInterfaceOwnerCache> interfaceOwnerCache; /** Cached interface owners for the grab candidates. Entries are removed when the candidate stops overlapping. */
+	static uint32 interfaceCacheGeneration; /** Incremented to invalidate every hands interface owner cache. */
+	FVector lastCandidateCheckLocation; /** Location of the grab collider when the closest grab candidate was last picked. */
+	bool candidatesChanged; /** Has the grab candidates array changed since the closest grab candidate was last picked. */
+
 private:
 
-	/** Loops every 0.1 seconds checking if the handSkel component is currently overlapping physics etc. If not re-enable collision, until then loop and check. */
-	UFUNCTION(Category = "Collision")
-	void CollisionDelay();
+	/** Called by the players collision clearance component once the handPhysics is no longer overlapping any blocking physics bodies to re-enable collision. */
+	void HandCollisionCleared(UPrimitiveComponent* clearedComp);
+
 
-	/** Check for overlapping actors with the grab Collider. (Runs Overlapping begin and end in hands interface on any actors with said interface) */
+	/** Check for overlapping actors with the grab Collider. (Runs Overlapping begin and end in hands interface on any actors with said interface)
+	 * NOTE: Only re-picks the closest candidate when the grab candidates have changed or the hand has moved further than the candidateUpdateDistance. */
 	void CheckForOverlappingActors();
 
 	/** Function to find the first intractable interface going from the component up through the parents to the actor.
+	 * NOTE: Uses the cached result for the component unless its attachment or tags have changed since it was last found.
 	 * @Param comp, Component to look through itself and its children components for the interface.
 	 * @Return UObject pointer to the game object that owns the interface. */
 	UObject* LookForInterface(USceneComponent* comp);
 
+	/** Walks the component, its actor and attach parents to find the interface owner. Used by LookForInterface when there is no valid cached result.
+	 * @Param comp, Component to look through itself and its children components for the interface.
+	 * @Return UObject pointer to the game object that owns the interface. */
+	UObject* FindInterfaceOwner(USceneComponent* comp);
+
 	/** When the distance between the hand and the grabbed component becomes too great it is released from the hand. */
 	void CheckInteractablesDistance();
 
 	/** Update finger tracking functionality as-well as resizing physics collision based off curled fingers. */
 	void UpdateFingerTracking();
 
+	/** Precompute the collider states from open to closed using the colliderStateCount. */
+	void BuildColliderStates();
+
+	/** Apply the collider state for the current fingers closed alpha if it has moved far enough from the current collider state. */
+	void UpdateColliderState();
+
+	/** Move the hand visual to the physics hands offset from the target it was driven towards, so only the physics correction and not the frame of
+	 * lag is kept when the controller late update moves it on the render thread. */
+	void UpdateVisualPose();
+
+	/** Render a held grabbables mesh from heldVisual instead of itself, showing the previous one again.
+	 * @Param heldMesh, The mesh to render from heldVisual, null to stop. */
+	void SetHeldVisual(UStaticMeshComponent* heldMesh);
+
 	/** Update the hand animation variables. */
 	void UpdateAnimationInstance();
 
-	/** Update telekinetic grabbing for retrieving items up-to a given distance. */
+	/** Update telekinetic grabbing for retrieving items up-to a given distance. Found grabbables are pulled by the grab handle and grabbed once they reach the hand.
+	 * NOTE: Only sweeps when a registered grabbable is inside the telekinetic cone, and only again once the aim or the grabbables inside the cone change. */
 	void UpdateTelekineticGrab();
 
+	/** Async telekinetic sweep result callback, consumed on the next telekinetic update.
+	 * @Param handle, The handle of the finished sweep.
+	 * @Param data, The results of the finished sweep. */
+	void TelekineticSweepFinished(const FTraceHandle& handle, FTraceDatum& data);
+
+	/** Clear the telekinetic search so the next update sweeps again. */
+	void ResetTelekineticSearch();
+
+	/** Stop pulling the lerping grabbable, releasing it from the grab handle and re-enabling collision on the hand. */
+	void CancelTelekineticPull();
+
 public:
 
 	/** Constructor */
@@ -230,6 +366,30 @@ public:
 	UFUNCTION(Category = "Collision")
 	void WidgetInteractorOverlapBegin(class UPrimitiveComponent* OverlappedComp, class AActor* OtherActor, class UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
 
+	/** Grab collider begin overlap event. Adds the overlapped component to the grab candidates. */
+	UFUNCTION(Category = "Collision")
+	void GrabColliderOverlapBegin(class UPrimitiveComponent* OverlappedComp, class AActor* OtherActor, class UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+
+	/** Grab collider end overlap event. Removes the overlapped component from the grab candidates. */
+	UFUNCTION(Category = "Collision")
+	void GrabColliderOverlapEnd(class UPrimitiveComponent* OverlappedComp, class AActor* OtherActor, class UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
+
+	/** Invalidate the cached interface owners in both hands. Called by the interactables when they are attached, detached or destroyed.
+	 * NOTE: Must be called after anything changes the attachment of a component that could be grabbed, or use the functions below for "Grabbable" tags. */
+	static void InvalidateInterfaceCache();
+
+	/** Add or remove the "Grabbable" tag of a component, invalidating the cached interface owners.
+	 * @Param comp, The component to change the tag of.
+	 * @Param grabbable, Should the component have the tag. */
+	UFUNCTION(BlueprintCallable, Category = "Grabbing")
+	static void SetComponentGrabbable(UActorComponent* comp, bool grabbable);
+
+	/** Add or remove the "Grabbable" tag of an actor, invalidating the cached interface owners.
+	 * @Param actor, The actor to change the tag of.
+	 * @Param grabbable, Should the actor have the tag. */
+	UFUNCTION(BlueprintCallable, Category = "Grabbing")
+	static void SetActorGrabbable(AActor* actor, bool grabbable);
+
 	/** Initialise variables given from the AVRPlayer, Also acts as this classes begin play.
 	 * @Param oppositeHand, Pointer to the other hand.
 	 * @Param playerRef, Pointer to the VRPawn class. 
@@ -278,7 +438,8 @@ public:
 	void TeleportHand();
 
 	/** Toggle collision of all components for the hand to ignore other actor collisions.
-	 * @Param open, open = activate collision and !open = ignore collisions. */
+	 * @Param open, open = activate collision and !open = ignore collisions.
+	 * @Param enableDelay, Minimum time before collision is re-enabled, negative uses 0.1 seconds. It is still only re-enabled once the hand is clear of blocking physics bodies. *
 	void ActivateCollision(bool enable, float enableDelay = -1.0f);
 
 	/** Reset the given VR physics handle to its default properties. 
@@ -293,9 +454,11 @@ public:
 	 * @Param feedback, the feedback effect to use, if left null this function will use the defaultFeedback in the pawn class.
 	 * @Param intensity, the intensity of the effect to play.
 	 * @Param replace, Should replace the current haptic effect playing? If there is one... 
-	 * @NOTE  If replace is false it will only replace a haptic feedback effect if the new intensity is greater than the current playing one. */
+	 * @Param priority, Higher priority feedback is never replaced by lower priority feedback.
+	 * @NOTE  If replace is false it will only replace a haptic feedback effect if the new intensity is greater than the current playing one.
+	 * @NOTE  Submitted to the players haptic scheduler, so only the strongest or highest priority request each frame is played. */
 	UFUNCTION(BlueprintCallable, Category = "Hands")
-	bool PlayFeedback(UHapticFeedbackEffect_Base* feedback = nullptr, float intensity = 1.0f, bool replace = false);
+	bool PlayFeedback(UHapticFeedbackEffect_Base* feedback = nullptr, float intensity = 1.0f, bool replace = false, int32 priority = 0);
 
 	/** Returns the effects container from the pawn class. */
 	UFUNCTION(BlueprintCallable, Category = "Hands")
@@ -310,6 +473,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Hands")
 	bool IsPlayingFeedback();
 
+	/** Predict the controllers transform at a time ahead of the newest tracked pose, using the velocity estimated from the pose history.
+	 * @Param secondsAhead, How far ahead of the newest tracked pose to predict.
+	 * @Return The predicted world transform of the controller. */
+	UFUNCTION(BlueprintCallable, Category = "Hands")
+	FTransform GetPredictedControllerTransform(float secondsAhead);
+
 	/** Disables all hand functionality for the current hand, used in developer mode mainly for disabling hands temporarily.
 	 * @Param disable, disable = disable the hand and !disable = enable the hand. */
 	UFUNCTION(BlueprintCallable, Category = "Hands")
@@ -0,0 +1,190 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Player/VRInputSnapshot.h"
+#include "MotionControllerComponent.h"
+#include "HeadMountedDisplayFunctionLibrary.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY(LogVRInput);
+
+/** Identifies and versions input recording files. */
+static const uint32 VRInputRecordingMagic = 0x56524950; // VRIP
+static const int32 VRInputRecordingVersion = 2;
+
+FArchive& operator<<(FArchive& ar, FVRHandInput& input)
+{
+	ar << input.curls.Thumb << input.curls.Index << input.curls.Middle << input.curls.Ring << input.curls.Pinky;
+	ar << input.splays.Thumb_Index << input.splays.Index_Middle << input.splays.Middle_Ring << input.splays.Ring_Pinky;
+	ar << input.trigger << input.squeeze << input.thumbstick;
+	ar << input.triggerPressed << input.thumbPressed << input.tracked;
+	ar << input.triggerEdges << input.thumbEdges;
+	return ar;
+}
+
+FArchive& operator<<(FArchive& ar, FVRInputSnapshot& snapshot)
+{
+	ar << snapshot.left << snapshot.right;
+	ar << snapshot.hmdTracked << snapshot.timeStamp << snapshot.frame;
+	return ar;
+}
+
+/////////////////////////////////////////////////////
+/**				Device input source.               */
+/////////////////////////////////////////////////////
+
+FDeviceVRInputSource::FDeviceVRInputSource(const FXRDeviceId& hmd, UMotionControllerComponent* leftController, UMotionControllerComponent* rightController)
+{
+	hmdDevice = hmd;
+	controllers[0] = leftController;
+	controllers[1] = rightController;
+}
+
+void FDeviceVRInputSource::Sample(const FVRInputSnapshot& liveInput, FVRInputSnapshot& outSnapshot)
+{
+	// Buttons, axes and timing come straight from the input bindings.
+	outSnapshot = liveInput;
+
+	// Read the skeletal summary of both hands.
+	USteamVRInputDeviceFunctionLibrary::GetFingerCurlsAndSplays(EHand::VR_LeftHand, outSnapshot.left.curls, outSnapshot.left.splays, ESkeletalSummaryDataType::VR_SummaryType_FromDevice);
+	USteamVRInputDeviceFunctionLibrary::GetFingerCurlsAndSplays(EHand::VR_RightHand, outSnapshot.right.curls, outSnapshot.right.splays, ESkeletalSummaryDataType::VR_SummaryType_FromDevice);
+
+	// Read the tracking state of the HMD and controllers.
+	outSnapshot.hmdTracked = UHeadMountedDisplayFunctionLibrary::IsDeviceTracking(hmdDevice);
+	outSnapshot.left.tracked = controllers[0].IsValid() && controllers[0]->IsTracked();
+	outSnapshot.right.tracked = controllers[1].IsValid() && controllers[1]->IsTracked();
+}
+
+/////////////////////////////////////////////////////
+/**				Recorded input source.             */
+/////////////////////////////////////////////////////
+
+FRecordedVRInputSource::FRecordedVRInputSource(const FString& file)
+{
+	currentFrame = 0;
+	if (!LoadRecording(file, frames))
+	{
+		UE_LOG(LogVRInput, Error, TEXT("Could not load the input recording %s."), *GetRecordingPath(file));
+	}
+}
+
+void FRecordedVRInputSource::Sample(const FVRInputSnapshot& liveInput, FVRInputSnapshot& outSnapshot)
+{
+	// Keep the live input if there is nothing to play.
+	if (frames.Num() == 0)
+	{
+		outSnapshot = liveInput;
+		return;
+	}
+
+	// Play the next frame and loop back to the start at the end of the recording.
+	outSnapshot = frames[currentFrame];
+	currentFrame = (currentFrame + 1) % frames.Num();
+}
+
+bool FRecordedVRInputSource::SaveRecording(const FString& file, const TArray<FVRInputSnapshot>& recording)
+{
+	// Write the header followed by every snapshot.
+	TArray<uint8> data;
+	FMemoryWriter writer(data);
+	uint32 magic = VRInputRecordingMagic;
+	int32 version = VRInputRecordingVersion;
+	int32 frameCount = recording.Num();
+	writer << magic << version << frameCount;
+	for (const FVRInputSnapshot& snapshot : recording)
+	{
+		writer << const_cast<FVRInputSnapshot&>(snapshot);
+	}
+
+	return FFileHelper::SaveArrayToFile(data, *GetRecordingPath(file));
+}
+
+bool FRecordedVRInputSource::LoadRecording(const FString& file, TArray<FVRInputSnapshot>& outRecording)
+{
+	outRecording.Reset();
+	TArray<uint8> data;
+	if (!FFileHelper::LoadFileToArray(data, *GetRecordingPath(file))) return false;
+
+	// Check the header before reading any snapshots.
+	FMemoryReader reader(data);
+	uint32 magic = 0;
+	int32 version = 0;
+	int32 frameCount = 0;
+	reader << magic << version << frameCount;
+	if (magic != VRInputRecordingMagic || version != VRInputRecordingVersion || frameCount < 0) return false;
+
+	// Read the snapshots.
+	outRecording.SetNum(frameCount);
+	for (FVRInputSnapshot& snapshot : outRecording)
+	{
+		reader << snapshot;
+	}
+
+	// Discard a truncated recording.
+	if (reader.IsError())
+	{
+		outRecording.Reset();
+		return false;
+	}
+	return true;
+}
+
+FString FRecordedVRInputSource::GetRecordingPath(const FString& file)
+{
+	if (FPaths::IsRelative(file)) return FPaths::Combine(FPaths::ProjectSavedDir(), file);
+	return file;
+}
+
+/////////////////////////////////////////////////////
+/**				Synthetic input source.            */
+/////////////////////////////////////////////////////
+
+FSyntheticVRInputSource::FSyntheticVRInputSource(float cyclePeriod, float timeStep)
+{
+	period = FMath::Max(cyclePeriod, KINDA_SMALL_NUMBER);
+	step = FMath::Max(timeStep, KINDA_SMALL_NUMBER);
+	sampleCount = 0;
+}
+
+void FSyntheticVRInputSource::Sample(const FVRInputSnapshot& liveInput, FVRInputSnapshot& outSnapshot)
+{
+	// Advance a fixed step per sample.
+	float time = sampleCount * step;
+	sampleCount++;
+
+	// Everything is always tracked, the right hand runs half a cycle behind the left.
+	outSnapshot = FVRInputSnapshot();
+	outSnapshot.hmdTracked = true;
+	outSnapshot.timeStamp = time;
+	outSnapshot.frame = sampleCount;
+	SynthesizeHand(time, 0.0f, outSnapshot.left);
+	SynthesizeHand(time, PI, outSnapshot.right);
+
+	// Presses and releases are the changes from the last sample.
+	outSnapshot.left.CountEdges(lastSample.left);
+	outSnapshot.right.CountEdges(lastSample.right);
+	lastSample = outSnapshot;
+}
+
+void FSyntheticVRInputSource::SynthesizeHand(float time, float phase, FVRHandInput& outHand) const
+{
+	// Open and close the hand once per period, with each finger slightly behind the last.
+	float angle = (time / period) * 2.0f * PI + phase;
+	float curl = 0.5f - 0.5f * FMath::Cos(angle);
+	outHand.curls.Thumb = curl;
+	outHand.curls.Index = 0.5f - 0.5f * FMath::Cos(angle - 0.1f);
+	outHand.curls.Middle = 0.5f - 0.5f * FMath::Cos(angle - 0.2f);
+	outHand.curls.Ring = 0.5f - 0.5f * FMath::Cos(angle - 0.3f);
+	outHand.curls.Pinky = 0.5f - 0.5f * FMath::Cos(angle - 0.4f);
+
+	// The trigger and grip follow the curl, the trigger button is held near the top of the pull.
+	outHand.trigger = curl;
+	outHand.triggerPressed = curl > 0.9f;
+	outHand.squeeze = FMath::Max(curl - 0.5f, 0.0f) * 2.0f;
+
+	// Trace a circle with the thumbstick at half deflection.
+	outHand.thumbstick = FVector2D(FMath::Cos(angle), FMath::Sin(angle)) * 0.5f;
+	outHand.tracked = true;
+}
@@ -0,0 +1,250 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "InputCoreTypes.h"
+#include "IIdentifiableXRDevice.h"
+#include "SteamVRInputDevice/Public/SteamVRInputDeviceFunctionLibrary.h"
+#include "VRInputSnapshot.generated.h"
+
+/** Declare log type for the input snapshot and its sources. */
+DECLARE_LOG_CATEGORY_EXTERN(LogVRInput, Log, All);
+
+/** Declare classes used. */
+class UMotionControllerComponent;
+
+/** Where the player samples its per-frame input snapshot from. */
+UENUM(BlueprintType)
+enum class EVRInputSourceType : uint8
+{
+	Device UMETA(DisplayName = "Device", ToolTip = "SteamVR skeletal data, HMD/controller tracking and the pawns input bindings."),
+	Recorded UMETA(DisplayName = "Recorded", ToolTip = "Plays back a recording of input snapshots saved by a previous session."),
+	Synthetic UMETA(DisplayName = "Synthetic", ToolTip = "Procedurally generated input that opens and closes the hands, pulls the triggers and circles the thumbsticks.")
+};
+
+/** Digital buttons written into the live input by the pawns action bindings. */
+enum class EVRInputButton : uint8
+{
+	TriggerLeft,
+	TriggerRight,
+	ThumbLeft,
+	ThumbRight
+};
+
+/** Input state of a single hand for one frame. */
+USTRUCT(BlueprintType)
+struct VRPROJECT_API FVRHandInput
+{
+	GENERATED_BODY()
+
+	/** Finger curls from the skeletal summary. */
+	UPROPERTY(BlueprintReadOnly, Category = "Input")
+	FSteamVRFingerCurls curls;
+
+	/** Finger splays from the skeletal summary. */
+	UPROPERTY(BlueprintReadOnly, Category = "Input")
+	FSteamVRFingerSplays splays;
+
+	/** Analog trigger value. */
+	UPROPERTY(BlueprintReadOnly, Category = "Input")
+	float trigger;
+
+	/** Analog grip squeeze value. */
+	UPROPERTY(BlueprintReadOnly, Category = "Input")
+	float squeeze;
+
+	/** Thumbstick axis values. */
+	UPROPERTY(BlueprintReadOnly, Category = "Input")
+	FVector2D thumbstick;
+
+	/** Is the trigger button held. */
+	UPROPERTY(BlueprintReadOnly, Category = "Input")
+	bool triggerPressed;
+
+	/** Is the thumb button held. */
+	UPROPERTY(BlueprintReadOnly, Category = "Input")
+	bool thumbPressed;
+
+	/** Is the controller being tracked. */
+	UPROPERTY(BlueprintReadOnly, Category = "Input")
+	bool tracked;
+
+	/** Trigger presses and releases since the last snapshot, so a press and release within the same frame isn't lost. */
+	UPROPERTY(BlueprintReadOnly, Category = "Input")
+	int32 triggerEdges;
+
+	/** Thumb button presses and releases since the last snapshot. */
+	UPROPERTY(BlueprintReadOnly, Category = "Input")
+	int32 thumbEdges;
+
+	/** Constructor. */
+	FVRHandInput()
+		: trigger(0.0f)
+		, squeeze(0.0f)
+		, thumbstick(FVector2D::ZeroVector)
+		, triggerPressed(false)
+		, thumbPressed(false)
+		, tracked(false)
+		, triggerEdges(0)
+		, thumbEdges(0)
+	{}
+
+	/** Count the button edges from a previous state to this one, for sources that only produce the held state of each button. */
+	FORCEINLINE void CountEdges(const FVRHandInput& previous)
+	{
+		if (triggerPressed != previous.triggerPressed) triggerEdges++;
+		if (thumbPressed != previous.thumbPressed) thumbEdges++;
+	}
+
+	/** Clear the button edges once they have been sampled. */
+	FORCEINLINE void ClearEdges()
+	{
+		triggerEdges = 0;
+		thumbEdges = 0;
+	}
+
+	/** Serialize for input recordings. */
+	friend FArchive& operator<<(FArchive& ar, FVRHandInput& input);
+};
+
+/** Input state of both hands and the HMD, sampled once at the start of each frame before the hands and movement update.
+ * NOTE: Everything that reads controller input should read it from the players snapshot so a recorded or synthetic source can drive the whole pipeline. */
+USTRUCT(BlueprintType)
+struct VRPROJECT_API FVRInputSnapshot
+{
+	GENERATED_BODY()
+
+	/** Left hand input. */
+	UPROPERTY(BlueprintReadOnly, Category = "Input")
+	FVRHandInput left;
+
+	/** Right hand input. */
+	UPROPERTY(BlueprintReadOnly, Category = "Input")
+	FVRHandInput right;
+
+	/** Is the HMD being tracked. */
+	UPROPERTY(BlueprintReadOnly, Category = "Input")
+	bool hmdTracked;
+
+	/** Time in seconds the snapshot was sampled at. */
+	UPROPERTY(BlueprintReadOnly, Category = "Input")
+	float timeStamp;
+
+	/** Index of the frame the snapshot was sampled on. */
+	UPROPERTY(BlueprintReadOnly, Category = "Input")
+	int32 frame;
+
+	/** Constructor. */
+	FVRInputSnapshot()
+		: hmdTracked(false)
+		, timeStamp(0.0f)
+		, frame(0)
+	{}
+
+	/** @Return the input of the given hand. */
+	FORCEINLINE FVRHandInput& GetHand(EControllerHand hand) { return hand == EControllerHand::Left ? left : right; }
+	FORCEINLINE const FVRHandInput& GetHand(EControllerHand hand) const { return hand == EControllerHand::Left ? left : right; }
+
+	/** Serialize for input recordings. */
+	friend FArchive& operator<<(FArchive& ar, FVRInputSnapshot& snapshot);
+};
+
+/** Source the player samples its input snapshot from each frame. */
+class VRPROJECT_API IVRInputSource
+{
+public:
+
+	/** Destructor. */
+	virtual ~IVRInputSource() {}
+
+	/** Fill the snapshot for this frame.
+	 * @Param liveInput, Button, axis and timing state written by the pawns input bindings this frame.
+	 * @Param outSnapshot, The snapshot to fill. */
+	virtual void Sample(const FVRInputSnapshot& liveInput, FVRInputSnapshot& outSnapshot) = 0;
+
+	/** @Return the name of the source for logging. */
+	virtual const TCHAR* GetName() const = 0;
+};
+
+/** Input source that reads the SteamVR skeletal summaries and the tracking state of the HMD and controllers. Buttons and axes come from the input bindings. */
+class VRPROJECT_API FDeviceVRInputSource : public IVRInputSource
+{
+public:
+
+	/** Constructor.
+	 * @Param hmd, Device ID of the HMD to check tracking for.
+	 * @Param leftController, The motion controller of the left hand.
+	 * @Param rightController, The motion controller of the right hand. */
+	FDeviceVRInputSource(const FXRDeviceId& hmd, UMotionControllerComponent* leftController, UMotionControllerComponent* rightController);
+
+	virtual void Sample(const FVRInputSnapshot& liveInput, FVRInputSnapshot& outSnapshot) override;
+	virtual const TCHAR* GetName() const override { return TEXT("Device"); }
+
+private:
+
+	FXRDeviceId hmdDevice; /** Device ID of the HMD. */
+	TWeakObjectPtr<UMotionControllerComponent> controllers[2]; /** The left and right motion controllers. */
+};
+
+/** Input source that plays back a recording of snapshots frame by frame, looping at the end.
+ * NOTE: Plays one recorded frame per sample regardless of frame time so runs are deterministic for benchmarking. */
+class VRPROJECT_API FRecordedVRInputSource : public IVRInputSource
+{
+public:
+
+	/** Constructor. Loads the recording from the given file.
+	 * @Param file, Path to the recording, relative paths are from the projects saved directory. */
+	FRecordedVRInputSource(const FString& file);
+
+	virtual void Sample(const FVRInputSnapshot& liveInput, FVRInputSnapshot& outSnapshot) override;
+	virtual const TCHAR* GetName() const override { return TEXT("Recorded"); }
+
+	/** @Return true if the recording loaded with at least one frame. */
+	bool IsLoaded() const { return frames.Num() > 0; }
+
+	/** Save a recording of snapshots to be played back by this source.
+	 * @Param file, Path to save to, relative paths are from the projects saved directory.
+	 * @Param recording, The snapshots to save.
+	 * @Return true if the file was written. */
+	static bool SaveRecording(const FString& file, const TArray<FVRInputSnapshot>& recording);
+
+	/** Load a recording of snapshots.
+	 * @Param file, Path to load from, relative paths are from the projects saved directory.
+	 * @Param outRecording, The loaded snapshots.
+	 * @Return true if the file was read and is a valid recording. */
+	static bool LoadRecording(const FString& file, TArray<FVRInputSnapshot>& outRecording);
+
+private:
+
+	TArray<FVRInputSnapshot> frames; /** The recorded snapshots. */
+	int32 currentFrame; /** Index of the next frame to play. */
+
+	/** @Return the full path of a recording file. */
+	static FString GetRecordingPath(const FString& file);
+};
+
+/** Input source that generates input procedurally without any hardware. Both hands are tracked and cycle between open and closed with the
+ * trigger and grip following the curls, while the thumbsticks trace a circle.
+ * NOTE: Advances a fixed time step per sample so runs are deterministic for benchmarking. */
+class VRPROJECT_API FSyntheticVRInputSource : public IVRInputSource
+{
+public:
+
+	/** Constructor.
+	 * @Param cyclePeriod, Time in seconds for a hand to open and close once.
+	 * @Param timeStep, Time in seconds advanced per sample. */
+	FSyntheticVRInputSource(float cyclePeriod = 2.0f, float timeStep = 1.0f / 90.0f);
+
+	virtual void Sample(const FVRInputSnapshot& liveInput, FVRInputSnapshot& outSnapshot) override;
+	virtual const TCHAR* GetName() const override { return TEXT("Synthetic"); }
+
+private:
+
+	float period; /** Time for a hand to open and close once. */
+	float step; /** Time advanced per sample. */
+	int32 sampleCount; /** Samples generated so far. */
+	FVRInputSnapshot lastSample; /** The previous generated snapshot, used to count button edges. */
+
+	/** Generate the input of a single hand at the given time, offset by phase in radians. */
+	void SynthesizeHand(float time, float phase, FVRHandInput& outHand) const;
+};
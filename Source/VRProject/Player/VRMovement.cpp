@@ -4,28 +4,39 @@
 #include "Player/VRPlayer.h"
 #include "Player/VRHand.h"
 #include "Project/VRFunctionLibrary.h"
+#include "Project/TickTrace.h"
 #include "GameFramework/Actor.h"
 #include "GameFramework/PlayerController.h"
 #include "PhysicsEngine/PhysicsHandleComponent.h"
 #include "Components/PrimitiveComponent.h"
-#include "Components/SplineComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/BoxComponent.h"
 #include "Components/SphereComponent.h"
-#include "Components/SplineMeshComponent.h"
+#include "ProceduralMeshComponent.h"
 #include "Camera/CameraComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Materials/MaterialInstanceDynamic.h" 
+#include "Materials/MaterialParameterCollection.h"
+#include "Materials/MaterialParameterCollectionInstance.h"
 #include "NavigationQueryFilter.h"
 #include "NavigationSystem.h"
 #include "NavigationData.h"
 #include "DrawDebugHelpers.h"
 #include "TimerManager.h"
+#include "Scalability.h"
+#include "Async/Async.h"
 
 DEFINE_LOG_CATEGORY(LogVRMovement);
 
+DECLARE_STATS_GROUP(TEXT("VRTeleport"), STATGROUP_VRTeleport, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Teleport game thread"), STAT_TeleportGameThread, STATGROUP_VRTeleport);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pipeline depth"), STAT_TeleportPipelineDepth, STATGROUP_VRTeleport);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Result latency (frames)"), STAT_TeleportLatencyFrames, STATGROUP_VRTeleport);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Result latency (ms)"), STAT_TeleportLatencyMs, STATGROUP_VRTeleport);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Material parameter writes"), STAT_TeleportMaterialWrites, STATGROUP_VRTeleport);
+
 AVRMovement::AVRMovement()
 {
 	PrimaryActorTick.bCanEverTick = true;
@@ -35,14 +46,7 @@ AVRMovement::AVRMovement()
 	scene->SetMobility(EComponentMobility::Movable);
 	RootComponent = scene;
 
-	// Spline for teleport beam.
-	teleportSpline = CreateDefaultSubobject<USplineComponent>(TEXT("TeleportSpline"));
-	teleportSpline->Duration = 1.0f;
-	teleportSpline->SetClosedLoop(false);
-	teleportSpline->SetDefaultUpVector(FVector(0.0f, 0.0f, 1.0f), ESplineCoordinateSpace::World);
-	teleportSpline->SetupAttachment(scene);
-
-	// Setup teleporting meshes and spline.
+	// Setup teleporting meshes.
 	teleportRing = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("TeleportRing"));
 	teleportRing->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
 	teleportRing->SetCollisionObjectType(ECollisionChannel::ECC_GameTraceChannel4);
@@ -61,6 +65,16 @@ AVRMovement::AVRMovement()
 	teleportSplineEndMesh->SetWorldScale3D(FVector(0.03f, 0.03f, 0.03f));
 	teleportSplineEndMesh->SetupAttachment(scene);
 
+	// The arc vertices are written in world space so keep the arc mesh at the world origin.
+	teleportArcMesh = CreateDefaultSubobject<UProceduralMeshComponent>(TEXT("TeleportArcMesh"));
+	teleportArcMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	teleportArcMesh->SetCastShadow(false);
+	teleportArcMesh->SetVisibility(false);
+	teleportArcMesh->SetUsingAbsoluteLocation(true);
+	teleportArcMesh->SetUsingAbsoluteRotation(true);
+	teleportArcMesh->SetUsingAbsoluteScale(true);
+	teleportArcMesh->SetupAttachment(scene);
+
 	// Setup default values.
 	invalidTeleportColor = FLinearColor::Red;
 	validTeleportColor = FLinearColor::Green;
@@ -72,6 +86,25 @@ AVRMovement::AVRMovement()
 	teleporting = false;
 	cameraFadeTimeToLast = 0.1f;
 	teleportHeight = 100.0f;
+	teleportArcSegments = 64;
+	teleportArcQualitySegments = { 12, 20, 32, 48 };
+	teleportArcErrorAngle = 0.1f;
+	teleportArcSides = 6;
+	teleportArcRadius = 1.0f;
+	teleportMaterial = nullptr;
+	teleportMAT = nullptr;
+	teleportColorWritten = false;
+	teleportArcShowing = false;
+	teleportNavCacheCellSize = 10.0f;
+	teleportNavCacheSize = 2048;
+	useTeleportGrid = true;
+	pipelinedTeleport = false;
+	pipelinedHand = nullptr;
+	projectionPending = false;
+	queuedArcFrame = 0;
+	queuedArcTime = 0.0;
+	resolvedArcFrame = 0;
+	resolvedArcTime = 0.0;
 	teleportDeadzone = 0.4f;
 	teleportDistance = 1000.0f;
 	teleportGravity = -1600.0f;
@@ -82,7 +115,12 @@ AVRMovement::AVRMovement()
 	cameraMoveDirection = true;
 	vignetteDuringMovement = true;
 	canApplyVignette = true;
+	vignetteMAT = nullptr;
+	vignetteParameters = nullptr;
 	lastVignetteOpacity = 1.0f;
+	vignetteTarget = 1.0f;
+	vignetteFadeOpacity = 1.0f;
+	vignetteFadeTime = 0.0f;
 	minVignetteSpeed = 0.2f;
 	vignetteTransitionSpeed = 5.0f;
 	devHandOffset = FVector(70.0f, 25.0f, 8.0f);
@@ -106,6 +144,9 @@ void AVRMovement::Tick(float DeltaTime)
 	//  Check if the capsule is currently in the air and if it is enable physics, otherwise disable physics.
 	if (player)
 	{
+		// Fade the vignette once per frame.
+		if (vignetteDuringMovement) UpdateVignette();
+
 		switch (currentMovementMode)
 		{
 #if WITH_EDITOR
@@ -120,14 +161,13 @@ void AVRMovement::Tick(float DeltaTime)
 		{
 			if (!physicsBasedMovement)
 			{
-				FHitResult floorCheck;
-				FCollisionQueryParams floorTraceParams;
+				// The floor is only traced once the feet have moved, or not at all when the capsule reports landing on something walkable.
+				FCollisionQueryParams floorTraceParams(SCENE_QUERY_STAT(GroundContact), false);
 				floorTraceParams.AddIgnoredActor(this);
 				floorTraceParams.AddIgnoredActor(player);
-				FVector feetLocation = player->scene->GetComponentLocation();
-				GetWorld()->LineTraceSingleByProfile(floorCheck, feetLocation, feetLocation - FVector(0.0f, 0.0f, 1.0f), "PlayerCapsule", floorTraceParams);
+				bool grounded = groundContact.Update(GetWorld(), player->scene->GetComponentLocation(), "PlayerCapsule", floorTraceParams, DeltaTime);
 				// If the floor was not found enable physics.
-				if (floorCheck.bBlockingHit)
+				if (grounded)
 				{
 					if (player->movementCapsule->IsSimulatingPhysics()) EnableCapsule(false);
 				}
@@ -137,6 +177,18 @@ void AVRMovement::Tick(float DeltaTime)
 		break;
 		}
 	}
+
+	FVRTickTrace::Record(this, FVRTickTrace::EStage::MovementUpdated);
+}
+
+void AVRMovement::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	Super::EndPlay(EndPlayReason);
+
+	// Nothing can be in flight once the world is torn down.
+	FWorldDelegates::OnWorldPostActorTick.Remove(postActorTickHandle);
+	postActorTickHandle.Reset();
+	CancelPipelinedTeleport();
 }
 
 void AVRMovement::SetupMovement(AVRPlayer* playerPawn, bool dev)
@@ -156,8 +208,29 @@ void AVRMovement::SetupMovement(AVRPlayer* playerPawn, bool dev)
 	if (navProps.Num() > agentID && navProps[agentID].IsValid()) player->floatingMovement->NavAgentProps = navProps[agentID];
 	else UE_LOG(LogVRMovement, Warning, TEXT("The agentID is out of bounds, navmesh may not support all agents..."));
 
+	// Resolve the agents nav data again and start with an empty projection cache that is cleared whenever the nav mesh is rebuilt.
+	teleportNavData.Reset();
+	teleportNavCache.Init(teleportNavCacheCellSize, teleportNavCacheSize);
+	navSystem->OnNavigationGenerationFinishedDelegate.AddUniqueDynamic(this, &AVRMovement::OnNavigationGenerationFinished);
+
+	// Collect pipelined teleport projections once every actor has ticked.
+	if (!postActorTickHandle.IsValid()) postActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &AVRMovement::OnWorldPostActorTick);
+
+	// Map the baked teleport grid for this level if there is one.
+	if (useTeleportGrid)
+	{
+		const FNavAgentProperties& agentProps = player->floatingMovement->GetNavAgentPropertiesRef();
+		FString mapName = UWorld::RemovePIEPrefix(GetWorld()->GetMapName());
+		if (!teleportGrid.Load(mapName, agentProps.AgentRadius, agentProps.AgentHeight, teleportSearchDistance)) UE_LOG(LogVRMovement, Log, TEXT("No teleport grid for %s, teleport locations will be projected onto the nav mesh."), *mapName);
+	}
+	else teleportGrid.Unload();
+
+	// Create the teleport arc mesh up front so aiming only ever rewrites its vertices.
+	CreateTeleportArcMesh();
+
 	// Reset this in case the setup movement is being ran for a second time during runtime.
 	canApplyVignette = true;
+	lastVignetteOpacity = vignetteTarget = vignetteFadeOpacity = 1.0f;
 	player->vignette->SetActive(false);
 	player->vignette->SetVisibility(false);
 	EnableCapsule(false);
@@ -209,10 +282,12 @@ void AVRMovement::SetupMovement(AVRPlayer* playerPawn, bool dev)
 		{
 			if (vingetteMATInstance)
 			{
+				// Start fully transparent, the vignette is only shown while it is fading in or visible.
 				player->vignette->SetActive(true);
-				player->vignette->SetVisibility(true);
-				vignetteMAT = player->vignette->CreateDynamicMaterialInstance(0, vingetteMATInstance);
-				vignetteMAT->SetScalarParameterValue("opacity", 1.0f);
+				if (vignetteParameters) player->vignette->SetMaterial(0, vingetteMATInstance);
+				else vignetteMAT = player->vignette->CreateDynamicMaterialInstance(0, vingetteMATInstance);
+				if (vignetteMAT) vignetteMAT->SetScalarParameterValue("opacity", 1.0f);
+				if (vignetteParameters) GetWorld()->GetParameterCollectionInstance(vignetteParameters)->SetScalarParameterValue("opacity", 1.0f);
 			}
 			else UE_LOG(LogVRMovement, Warning, TEXT("Null refference for the vignette material instance in the vr movement class..."));
 		}
@@ -222,6 +297,13 @@ void AVRMovement::SetupMovement(AVRPlayer* playerPawn, bool dev)
 		{
 			EnableCapsule(true);
 		}
+		// Otherwise track the ground, using the capsules own contacts to detect landing.
+		else
+		{
+			groundContact.Reset(true);
+			player->movementCapsule->SetNotifyRigidBodyCollision(true);
+			player->movementCapsule->OnComponentHit.AddUniqueDynamic(this, &AVRMovement::OnCapsuleHit);
+		}
 	}
 	break;
 	}
@@ -248,6 +330,11 @@ void AVRMovement::EnableCapsule(bool enable)
 	}
 }
 
+void AVRMovement::OnCapsuleHit(UPrimitiveComponent* hitComponent, AActor* otherActor, UPrimitiveComponent* otherComp, FVector normalImpulse, const FHitResult& hit)
+{
+	groundContact.NotifyContact(hit.ImpactNormal);
+}
+
 void AVRMovement::UpdateMovement(AVRHand* movementHand, bool released)
 {
 	// Ensure player is valid.
@@ -268,7 +355,7 @@ void AVRMovement::UpdateMovement(AVRHand* movementHand, bool released)
 				if (released)
 				{
 					if (lastTeleportValid) TeleportPlayer();
-					else DestroyTeleportSpline();
+					else HideTeleportSpline();
 				}
 				else UpdateTeleport(movementHand);
 			}
@@ -287,7 +374,7 @@ void AVRMovement::UpdateMovement(AVRHand* movementHand, bool released)
 							if (teleportFade) TeleportCameraFade();
 							else TeleportPlayer();
 						}
-						else DestroyTeleportSpline();
+						else HideTeleportSpline();
 					}
 					else UpdateTeleport(movementHand);
 				}
@@ -304,7 +391,7 @@ void AVRMovement::UpdateMovement(AVRHand* movementHand, bool released)
 			case EVRMovementMode::SwingingArms:
 			{
 				// Update the controller movement mode. If released and vignette is enabled ramp the opacity back down to invisible at the specified speed.
-				if (released && vignetteDuringMovement && vignetteMAT) GetWorld()->GetTimerManager().SetTimer(vignetteTimer, this, &AVRMovement::ResetVignette, 0.01f, true);
+				if (released && vignetteDuringMovement) ResetVignette();
 				else UpdateControllerMovement(movementHand);
 			}
 			break;
@@ -507,14 +594,8 @@ void AVRMovement::UpdateDeveloperMovement(float deltaTime)
 
 void AVRMovement::UpdateControllerMovement(AVRHand* movementHand)
 {
-	// Lerp opacity to visible. visible opacity = 0.0f
-	if (vignetteDuringMovement && canApplyVignette && vignetteMAT && lastVignetteOpacity > 0.0f)
-	{
-		// stop vignette reset function is playing on the world timer.
-		GetWorld()->GetTimerManager().ClearTimer(vignetteTimer);
-		// Lerp to location.
-		LerpVignette(0.0f);
-	}
+	// Fade opacity to visible. visible opacity = 0.0f
+	if (vignetteDuringMovement && canApplyVignette) FadeVignette(0.0f);
 
 	// Update the capsule if the player is not inside of it.
 	FVector capsuleOffset = player->movementCapsule->GetComponentLocation() - player->camera->GetComponentLocation();
@@ -596,7 +677,7 @@ void AVRMovement::UpdateControllerMovement(AVRHand* movementHand)
 		{
 			if (vignetteDuringMovement && canApplyVignette)
 			{
-				if (vignetteMAT) GetWorld()->GetTimerManager().SetTimer(vignetteTimer, this, &AVRMovement::ResetVignette, 0.01f, true);
+				ResetVignette();
 				canApplyVignette = false;
 			}
 			speedScale = 0.0f;
@@ -634,7 +715,7 @@ void AVRMovement::UpdateControllerMovement(AVRHand* movementHand)
 		if (speedScale > minVignetteSpeed) canApplyVignette = true;
 		else if (canApplyVignette)
 		{
-			GetWorld()->GetTimerManager().SetTimer(vignetteTimer, this, &AVRMovement::ResetVignette, 0.01f, true);
+			ResetVignette();
 			canApplyVignette = false;
 		}
 	}
@@ -648,22 +729,54 @@ void AVRMovement::UpdateControllerMovement(AVRHand* movementHand)
 
 void AVRMovement::ResetVignette()
 {
-	// End the reset once the opacity has been reset.
-	if (lastVignetteOpacity < 1.0f) LerpVignette(1.0f);
-	else GetWorld()->GetTimerManager().ClearTimer(vignetteTimer);
+	FadeVignette(1.0f);
 }
 
-void AVRMovement::LerpVignette(float target)
+void AVRMovement::FadeVignette(float target)
 {
-	float newOpacity = UKismetMathLibrary::FInterpTo(lastVignetteOpacity, target, GetWorld()->GetDeltaSeconds(), vignetteTransitionSpeed);
-	lastVignetteOpacity = newOpacity;
-	vignetteMAT->SetScalarParameterValue("opacity", newOpacity);
+	if (target == vignetteTarget) return;
+
+	// Restart the fade from wherever the current one has reached.
+	vignetteFadeOpacity = lastVignetteOpacity;
+	vignetteFadeTime = GetWorld()->GetTimeSeconds();
+	vignetteTarget = target;
+}
+
+void AVRMovement::UpdateVignette()
+{
+	if (!vignetteMAT && !vignetteParameters) return;
+
+	// Decay towards the target from the start of the fade, snapping once close enough that the difference can't be seen.
+	float elapsed = GetWorld()->GetTimeSeconds() - vignetteFadeTime;
+	float newOpacity = vignetteTarget + (vignetteFadeOpacity - vignetteTarget) * FMath::Exp(-vignetteTransitionSpeed * elapsed);
+	if (FMath::IsNearlyEqual(newOpacity, vignetteTarget, 0.001f)) newOpacity = vignetteTarget;
+
+	// Only write the opacity when it has changed.
+	if (newOpacity != lastVignetteOpacity)
+	{
+		lastVignetteOpacity = newOpacity;
+		if (vignetteParameters) GetWorld()->GetParameterCollectionInstance(vignetteParameters)->SetScalarParameterValue("opacity", newOpacity);
+		else vignetteMAT->SetScalarParameterValue("opacity", newOpacity);
+	}
+
+	// Hide the vignette entirely while it is fully transparent so it isn't rendered.
+	bool visible = lastVignetteOpacity < 1.0f;
+	if (player->vignette->IsVisible() != visible) player->vignette->SetVisibility(visible);
 }
 
 void AVRMovement::UpdateTeleport(AVRHand* movementHand)
 {
-	// Get rid of last frames spline and initially hide the teleport meshes.
-	DestroyTeleportSpline();
+	SCOPE_CYCLE_COUNTER(STAT_TeleportGameThread);
+
+	// Trace off the game thread and show the last completed result instead.
+	if (pipelinedTeleport)
+	{
+		UpdatePipelinedTeleport(movementHand);
+		return;
+	}
+
+	// Hide the teleport ring until a valid location is found, the arc mesh is rewritten in place.
+	teleportRing->SetVisibility(false, true);
 
 	// Create the teleport spline.
 	FVector splineEndLocation;
@@ -675,115 +788,202 @@ void AVRMovement::UpdateTeleport(AVRHand* movementHand)
 		// Continue to check if the location is valid if the end location is touching the ground.
 		if (requiresNavMesh) lastTeleportValid = ValidateTeleportLocation(splineEndLocation);
 		else  lastTeleportValid = true;
+		ShowTeleportLocation(movementHand, splineEndLocation);
+	}
+}
 
-		// If the last valid location is a valid location update the ring and arrow to that location and show them in game.
-		if (lastTeleportValid)
-		{
-			// Update the last valid teleport location.
-			lastValidTeleportLocation = splineEndLocation;
+void AVRMovement::ShowTeleportLocation(AVRHand* movementHand, const FVector& location)
+{
+	// If the last valid location is a valid location update the ring and arrow to that location and show them in game.
+	if (lastTeleportValid)
+	{
+		// Update the last valid teleport location.
+		lastValidTeleportLocation = location;
 
-			// Update the rotation direction depending on the thumb offset dead zone.
-			FVector thumbOffset = FVector(movementHand->thumbstick.X, movementHand->thumbstick.Y, 0.0f);
-			if (thumbOffset.Size() > FMath::Clamp(teleportDeadzone, 0.0f, 1.0f))
-			{
-				FRotator thumbRotation = UKismetMathLibrary::FindLookAtRotation(FVector::ZeroVector, thumbOffset);
-				teleportRotation = FRotator(thumbRotation.Pitch, player->camera->GetComponentRotation().Yaw + thumbRotation.Yaw + 90.0f, thumbRotation.Roll);
-				if (!teleportArrow->IsVisible()) teleportArrow->SetVisibility(true);
-			}
-			else
-			{
-				teleportRotation = FRotator::ZeroRotator;
-				if (teleportArrow->IsVisible()) teleportArrow->SetVisibility(false);
-			}
+		// Update the rotation direction depending on the thumb offset dead zone.
+		FVector thumbOffset = FVector(movementHand->thumbstick.X, movementHand->thumbstick.Y, 0.0f);
+		if (thumbOffset.Size() > FMath::Clamp(teleportDeadzone, 0.0f, 1.0f))
+		{
+			FRotator thumbRotation = UKismetMathLibrary::FindLookAtRotation(FVector::ZeroVector, thumbOffset);
+			teleportRotation = FRotator(thumbRotation.Pitch, player->camera->GetComponentRotation().Yaw + thumbRotation.Yaw + 90.0f, thumbRotation.Roll);
+			if (!teleportArrow->IsVisible()) teleportArrow->SetVisibility(true);
+		}
+		else
+		{
+			teleportRotation = FRotator::ZeroRotator;
+			if (teleportArrow->IsVisible()) teleportArrow->SetVisibility(false);
+		}
 
-			// Show the teleport meshes at the found valid location/rotation if its enabled.
-			teleportRing->SetWorldLocationAndRotation(lastValidTeleportLocation, teleportRotation, false, nullptr, ETeleportType::TeleportPhysics);
-			teleportRing->SetVisibility(true);
+		// Show the teleport meshes at the found valid location/rotation if its enabled.
+		teleportRing->SetWorldLocationAndRotation(lastValidTeleportLocation, teleportRotation, false, nullptr, ETeleportType::TeleportPhysics);
+		teleportRing->SetVisibility(true);
 
-			// Update the teleporting components materials to valid.
-			UpdateTeleportMaterials(true);
-		}
-		// Otherwise update the teleport material to invalid and disable lastTeleportValid.
-		else UpdateTeleportMaterials(false);
+		// Update the teleporting components materials to valid.
+		UpdateTeleportMaterials(true);
 	}
+	// Otherwise update the teleport material to invalid and disable lastTeleportValid.
+	else UpdateTeleportMaterials(false);
 }
 
-bool AVRMovement::CreateTeleportSpline(FTransform startTransform, FVector& outLocation)
+void AVRMovement::UpdatePipelinedTeleport(AVRHand* movementHand)
 {
-	teleportSpline->ClearSplinePoints();
-	teleportSpline->SetWorldLocationAndRotation(startTransform.GetLocation(), startTransform.GetRotation());
+	pipelinedHand = movementHand;
+	FTransform startTransform = movementHand->movementTarget->GetComponentTransform();
 
-	// Return false if the hand is too close to the world up vector.
-	if (FMath::IsNearlyEqual(startTransform.GetRotation().GetForwardVector().Z, 1.0f, 0.3f))
-	{
-		// First draw cancel VFX.
-		FVector startPoint = startTransform.GetLocation();
-		FVector endPoint = startPoint + (startTransform.GetRotation().GetForwardVector() * 30.0f);
-
-		// Make spline mesh to go from start point to end point.
-		FName splineMeshName = MakeUniqueObjectName(this, USplineMeshComponent::StaticClass(), FName("SplineMesh"));
-		USplineMeshComponent* newMesh = NewObject<USplineMeshComponent>(this, splineMeshName);
-		newMesh->SetMobility(EComponentMobility::Movable);
-		newMesh->RegisterComponent();
-		newMesh->SetStaticMesh(teleportSplineMesh);
-		newMesh->SetStartAndEnd(startPoint, FVector(0.0f), endPoint, FVector(0.0f));
-		splineMeshes.Add(newMesh);
-
-		// Set location and show the end mesh at the endPoint.
-		teleportSplineEndMesh->SetWorldLocation(endPoint, false, nullptr, ETeleportType::TeleportPhysics);
-		teleportSplineEndMesh->SetVisibility(true);
-
-		// Make teleport materials to be red. 
-		UpdateTeleportMaterials(false);
+	// Aiming straight up is cancelled straight away as there is nothing to trace.
+	if (DrawCancelledTeleportSpline(startTransform))
+	{
+		teleportRing->SetVisibility(false, true);
+		CancelPipelinedTeleport();
+		return;
+	}
 
-		// Return false for nothing found.
-		return false;
+	// Draw the arc traced last frame and start validating where it landed, the ring is updated once validated.
+	if (teleportArc.ResolveAsync(GetWorld()))
+	{
+		resolvedArcFrame = queuedArcFrame;
+		resolvedArcTime = queuedArcTime;
+		FVector arcEndLocation;
+		if (FinishTeleportSpline(arcEndLocation)) BeginTeleportProjection(arcEndLocation);
+		else teleportRing->SetVisibility(false, true);
 	}
 
-	// Projectile trace used to create the spline arc and find a teleport location.
-	FHitResult hit;
-	TArray<FVector> outPathPositions;
-	FVector outLastTraceDestination;
+	// Queue this frames arc to be traced alongside the rest of the frame.
+	float gravityZ = teleportGravity != 0.0f ? teleportGravity : GetWorld()->GetGravityZ();
+	teleportArc.TraceAsync(GetWorld(), startTransform.GetLocation(), startTransform.GetRotation().GetForwardVector() * teleportDistance, gravityZ, ECC_Teleport, GetTeleportArcParams());
+	queuedArcFrame = GFrameCounter;
+	queuedArcTime = FPlatformTime::Seconds();
+	SET_DWORD_STAT(STAT_TeleportPipelineDepth, (teleportArc.IsAsyncPending() ? 1 : 0) + (projectionPending ? 1 : 0));
+}
 
-	// Ignore self and ignore the player and anything thats currently held in the hand.
-	TArray<AActor*> actorsToIgnore;
-	actorsToIgnore.Add(player);
-	actorsToIgnore.Add(this);
-	actorsToIgnore.Add(currentMovingHand);
-	actorsToIgnore.Add(currentMovingHand->otherHand);
+void AVRMovement::BeginTeleportProjection(const FVector& location)
+{
+	if (!requiresNavMesh)
+	{
+		CompleteTeleportProjection(true, location);
+		return;
+	}
 
-	// Projectile trace the spline hit location and use each stage of the trace to create a spline from the shape.
-	// Same way unreal do it in their VRContent examples.
-	UGameplayStatics::Blueprint_PredictProjectilePath_ByTraceChannel(GetWorld(), hit, outPathPositions, outLastTraceDestination, teleportSpline->GetComponentLocation(), teleportSpline->GetForwardVector() * teleportDistance, true, 0.0f, ECC_Teleport, false, actorsToIgnore, EDrawDebugTrace::None, 0.0f, 30.0f, 2.0f, teleportGravity);
+	// Use the grid or cache on the game thread when they already have the answer.
+	bool cachedValid;
+	FVector cachedLocation;
+	if (teleportGrid.Find(location, cachedValid, cachedLocation) || teleportNavCache.Find(location, cachedValid, cachedLocation))
+	{
+		CompleteTeleportProjection(cachedValid, cachedValid ? cachedLocation : location);
+		return;
+	}
 
-	// Set the spline up from the projectile trace.
-	for (FVector splinePoint : outPathPositions)
+	// The nav mesh is only read off the game thread while it isn't being rebuilt, otherwise project it now.
+	UNavigationSystemV1* navSystem = Cast<UNavigationSystemV1>(GetWorld()->GetNavigationSystem());
+	ANavigationData* navData = GetTeleportNavData();
+	if (!navSystem || !navData || navSystem->IsNavigationBuildInProgress())
 	{
-		teleportSpline->AddSplinePoint(splinePoint, ESplineCoordinateSpace::World);
+		FVector foundLocation = location;
+		bool validLocation = ValidateTeleportLocation(foundLocation);
+		CompleteTeleportProjection(validLocation, foundLocation);
+		return;
 	}
-	teleportSpline->SetSplinePointType(outPathPositions.Num() - 1, ESplinePointType::CurveClamped);
 
-	// DO A RESOLUTION SCALE FOR SCALING DOWN HOW MANY SPLINE MESHES ARE BEING CREATED.
-	// For each spline point of the current hands spline create a spline mesh between them and add them to an array.
-	for (int i = 0; i < teleportSpline->GetNumberOfSplinePoints() - 1; i++)
+	// Project on a worker, the result is collected after every actor has ticked this frame.
+	UWorld* world = GetWorld();
+	FVector searchingExtent = FVector(teleportSearchDistance, teleportSearchDistance, teleportSearchDistance);
+	TArray<TEnumAsByte<EObjectTypeQuery>> floorTypes = teleportableTypes;
+	FCollisionQueryParams floorTraceParams;
+	floorTraceParams.AddIgnoredActor(this);
+	floorTraceParams.AddIgnoredActor(player);
+	pendingProjection = Async(EAsyncExecution::TaskGraph, [world, navSystem, navData, searchingExtent, floorTypes, floorTraceParams, location]()
 	{
-		FName splineMeshName = MakeUniqueObjectName(this, USplineMeshComponent::StaticClass(), FName("SplineMesh"));
-		USplineMeshComponent* newMesh = NewObject<USplineMeshComponent>(this, splineMeshName);
-		newMesh->SetMobility(EComponentMobility::Movable);
-		newMesh->RegisterComponent();
-		newMesh->SetStaticMesh(teleportSplineMesh);
-		newMesh->SetStartAndEnd(teleportSpline->GetLocationAtSplinePoint(i, ESplineCoordinateSpace::World), teleportSpline->GetTangentAtSplinePoint(i, ESplineCoordinateSpace::World), teleportSpline->GetLocationAtSplinePoint(i + 1, ESplineCoordinateSpace::World), teleportSpline->GetTangentAtSplinePoint(i + 1, ESplineCoordinateSpace::World));
-		splineMeshes.Add(newMesh);
+		FTeleportProjection result;
+		result.query = location;
+		result.valid = ProjectTeleportLocation(world, navSystem, navData, searchingExtent, floorTypes, floorTraceParams, location, result.projected, result.floorHeight);
+		return result;
+	});
+	projectionPending = true;
+}
+
+void AVRMovement::CompleteTeleportProjection(bool valid, const FVector& location)
+{
+	// Show the result from the arc it was traced from.
+	lastTeleportValid = valid;
+	if (pipelinedHand) ShowTeleportLocation(pipelinedHand, location);
+	if (!valid) teleportRing->SetVisibility(false, true);
+	SET_FLOAT_STAT(STAT_TeleportLatencyFrames, (float)(GFrameCounter - resolvedArcFrame));
+	SET_FLOAT_STAT(STAT_TeleportLatencyMs, (float)((FPlatformTime::Seconds() - resolvedArcTime) * 1000.0));
+}
+
+void AVRMovement::OnWorldPostActorTick(UWorld* world, ELevelTick tickType, float deltaTime)
+{
+	if (world != GetWorld() || !projectionPending) return;
+
+	// Collect the projection started this frame, it has had the rest of the frames ticking to finish.
+	SCOPE_CYCLE_COUNTER(STAT_TeleportGameThread);
+	FTeleportProjection result = pendingProjection.Get();
+	projectionPending = false;
+	pendingProjection = TFuture<FTeleportProjection>();
+	teleportNavCache.Add(result.query, result.valid, result.projected, result.floorHeight);
+	CompleteTeleportProjection(result.valid, FVector(result.projected.X, result.projected.Y, result.floorHeight));
+}
+
+void AVRMovement::CancelPipelinedTeleport()
+{
+	// Drop anything in flight, waiting on a projection as it reads the world.
+	teleportArc.CancelAsync();
+	if (projectionPending)
+	{
+		pendingProjection.Wait();
+		pendingProjection = TFuture<FTeleportProjection>();
+		projectionPending = false;
 	}
+	SET_DWORD_STAT(STAT_TeleportPipelineDepth, 0);
+}
+
+bool AVRMovement::CreateTeleportSpline(FTransform startTransform, FVector& outLocation)
+{
+	// Return false if the hand is too close to the world up vector.
+	if (DrawCancelledTeleportSpline(startTransform)) return false;
+
+	// Trace the arc natively, it stops at the first hit and reuses last frames hit segment while the aim is steady.
+	float gravityZ = teleportGravity != 0.0f ? teleportGravity : GetWorld()->GetGravityZ();
+	teleportArc.Trace(GetWorld(), startTransform.GetLocation(), startTransform.GetRotation().GetForwardVector() * teleportDistance, gravityZ, ECC_Teleport, GetTeleportArcParams());
+	return FinishTeleportSpline(outLocation);
+}
+
+bool AVRMovement::DrawCancelledTeleportSpline(const FTransform& startTransform)
+{
+	if (!FMath::IsNearlyEqual(startTransform.GetRotation().GetForwardVector().Z, 1.0f, 0.3f)) return false;
+
+	// First draw cancel VFX.
+	FVector startPoint = startTransform.GetLocation();
+	FVector endPoint = startPoint + (startTransform.GetRotation().GetForwardVector() * 30.0f);
+
+	// Draw the arc straight from the start point to the end point.
+	arcPoints = { startPoint, endPoint };
+	arcDirections = { startTransform.GetRotation().GetForwardVector(), startTransform.GetRotation().GetForwardVector() };
+	DrawTeleportArc();
+
+	// Set location and show the end mesh at the endPoint.
+	teleportSplineEndMesh->SetWorldLocation(endPoint, false, nullptr, ETeleportType::TeleportPhysics);
+	teleportSplineEndMesh->SetVisibility(true);
+
+	// Make teleport materials to be red. 
+	UpdateTeleportMaterials(false);
+	return true;
+}
+
+bool AVRMovement::FinishTeleportSpline(FVector& outLocation)
+{
+	// Sample the arc with as few segments as keep it looking curved from the camera, capped by the current quality level.
+	teleportArc.Sample(player->camera->GetComponentLocation(), teleportArcErrorAngle, GetTeleportArcSegmentCap(), arcPoints, arcDirections);
+	DrawTeleportArc();
 
 	// Set location and show the end mesh of the spline.
-	teleportSplineEndMesh->SetWorldLocation(teleportSpline->GetLocationAtSplinePoint(teleportSpline->GetNumberOfSplinePoints() - 1, ESplineCoordinateSpace::World), false, nullptr, ETeleportType::TeleportPhysics);
+	teleportSplineEndMesh->SetWorldLocation(teleportArc.GetEndLocation(), false, nullptr, ETeleportType::TeleportPhysics);
 	teleportSplineEndMesh->SetVisibility(true);
 
 	// Check if the hit location is a valid navigatable point on the nav mesh and return valid hit as bool.
-	if (hit.bBlockingHit)
+	if (teleportArc.HasHit())
 	{
-		outLocation = hit.Location + hit.Normal;
+		outLocation = teleportArc.GetHit().Location + teleportArc.GetHit().Normal;
 		return true;
 	}
 	else // Didn't hit anything so, show the invalid material.
@@ -794,18 +994,83 @@ bool AVRMovement::CreateTeleportSpline(FTransform startTransform, FVector& outLo
 	}
 }
 
-void AVRMovement::DestroyTeleportSpline()
+FCollisionQueryParams AVRMovement::GetTeleportArcParams() const
+{
+	// Ignore self and ignore the player and anything thats currently held in the hand.
+	FCollisionQueryParams arcParams(SCENE_QUERY_STAT(TeleportArc), false);
+	arcParams.AddIgnoredActor(player);
+	arcParams.AddIgnoredActor(this);
+	arcParams.AddIgnoredActor(currentMovingHand);
+	arcParams.AddIgnoredActor(currentMovingHand->otherHand);
+	return arcParams;
+}
+
+void AVRMovement::CreateTeleportArcMesh()
 {
-	// Clear the spline mesh array of any components.
-	if (splineMeshes.Num() != 0)
+	// Share one material instance between every teleport mesh so changing color is a single parameter write.
+	if (!teleportMAT)
 	{
-		for (USplineMeshComponent* splineMesh : splineMeshes)
+		UMaterialInterface* baseMaterial = teleportMaterial ? teleportMaterial : teleportRing->GetMaterial(0);
+		if (baseMaterial)
 		{
-			splineMesh->DestroyComponent();
+			teleportMAT = UMaterialInstanceDynamic::Create(baseMaterial, this);
+			teleportColorWritten = false;
+			for (UMeshComponent* teleportMesh : TArray<UMeshComponent*>({ teleportRing, teleportArrow, teleportSplineEndMesh }))
+			{
+				for (int32 i = 0; i < teleportMesh->GetNumMaterials(); i++)
+				{
+					teleportMesh->SetMaterial(i, teleportMAT);
+				}
+			}
 		}
-		splineMeshes.Empty();
+		else UE_LOG(LogVRMovement, Warning, TEXT("No teleport material is set and the teleport ring has no material to share, the teleport meshes will not change color."));
 	}
 
+	// Create the arc mesh section once at its largest size, after this only its vertices are updated.
+	if (teleportArcMeshData.IsInitialized()) return;
+	teleportArcMeshData.Init(teleportArcSegments, teleportArcSides, teleportArcRadius);
+	teleportArcMesh->CreateMeshSection(0, teleportArcMeshData.vertices, teleportArcMeshData.triangles, teleportArcMeshData.normals, teleportArcMeshData.uvs, TArray<FColor>(), TArray<FProcMeshTangent>(), false);
+	teleportArcMesh->SetMaterial(0, teleportMAT);
+	arcPoints.Reserve(teleportArcMeshData.GetMaxSegments() + 1);
+	arcDirections.Reserve(teleportArcMeshData.GetMaxSegments() + 1);
+}
+
+void AVRMovement::DrawTeleportArc()
+{
+	if (!teleportArcMeshData.IsInitialized()) return;
+
+	// Rewrite the existing vertex buffer in place, the triangles never change.
+	teleportArcMeshData.Update(arcPoints.GetData(), arcDirections.GetData(), arcPoints.Num());
+	teleportArcMesh->UpdateMeshSection(0, teleportArcMeshData.vertices, teleportArcMeshData.normals, teleportArcMeshData.uvs, TArray<FColor>(), TArray<FProcMeshTangent>());
+	if (!teleportArcShowing)
+	{
+		teleportArcMesh->SetVisibility(true);
+		teleportArcShowing = true;
+	}
+}
+
+int32 AVRMovement::GetTeleportArcSegmentCap() const
+{
+	int32 cap = teleportArcMeshData.GetMaxSegments();
+	if (teleportArcQualitySegments.Num() > 0)
+	{
+		int32 qualityLevel = FMath::Clamp(Scalability::GetQualityLevels().EffectsQuality, 0, teleportArcQualitySegments.Num() - 1);
+		cap = FMath::Min(cap, teleportArcQualitySegments[qualityLevel]);
+	}
+	return FMath::Max(cap, 1);
+}
+
+void AVRMovement::HideTeleportSpline()
+{
+	// Hide the arc mesh and start the next arc from scratch.
+	if (teleportArcShowing)
+	{
+		teleportArcMesh->SetVisibility(false);
+		teleportArcShowing = false;
+	}
+	teleportArc.Reset();
+	CancelPipelinedTeleport();
+
 	// Hide any of the visuals such as the end of the spline mesh, ring and arrow.
 	teleportSplineEndMesh->SetVisibility(false);
 	teleportRing->SetVisibility(false, true);
@@ -813,32 +1078,70 @@ void AVRMovement::DestroyTeleportSpline()
 
 bool AVRMovement::ValidateTeleportLocation(FVector& location)
 {
+	// Use the baked grid or reuse the projection for this area of the floor if it has already been found.
+	bool cachedValid;
+	FVector cachedLocation;
+	if (teleportGrid.Find(location, cachedValid, cachedLocation) || teleportNavCache.Find(location, cachedValid, cachedLocation))
+	{
+		if (cachedValid) location = cachedLocation;
+		return cachedValid;
+	}
+
 	UNavigationSystemV1* navSystem = Cast<UNavigationSystemV1>(GetWorld()->GetNavigationSystem());
-	if (navSystem)
+	ANavigationData* navData = GetTeleportNavData();
+	if (navSystem && navData)
 	{
-		// Get the nav properties from the players movement component to determine player width, height etc.
-		FVector foundLocation;
+		// Project onto the nav data of the players agent and correct the height to the floor.
 		FVector searchingExtent = FVector(teleportSearchDistance, teleportSearchDistance, teleportSearchDistance);
-		FNavAgentProperties props = player->floatingMovement->GetNavAgentPropertiesRef();
-		ANavigationData* navData = navSystem->GetNavDataForProps(props);
-		bool locationOnNav = navSystem->K2_ProjectPointToNavigation(GetWorld(), location, foundLocation, navData, nullptr, searchingExtent);
-		// If the location is on the nav-mesh return true and set location to said found location.
-		if (locationOnNav)
+		FCollisionQueryParams floorTraceParams;
+		floorTraceParams.AddIgnoredActor(this);
+		floorTraceParams.AddIgnoredActor(player);
+		FVector foundLocation;
+		float floorHeight;
+		bool locationOnNav = ProjectTeleportLocation(GetWorld(), navSystem, navData, searchingExtent, teleportableTypes, floorTraceParams, location, foundLocation, floorHeight);
+		teleportNavCache.Add(location, locationOnNav, locationOnNav ? foundLocation : location, locationOnNav ? floorHeight : location.Z);
+		if (locationOnNav) location = FVector(foundLocation.X, foundLocation.Y, floorHeight);
+		return locationOnNav;
+	}
+	else return false;
+}
+
+bool AVRMovement::ProjectTeleportLocation(UWorld* world, UNavigationSystemV1* navSystem, const ANavigationData* navData, const FVector& searchingExtent, const TArray<TEnumAsByte<EObjectTypeQuery>>& floorTypes, const FCollisionQueryParams& floorTraceParams, const FVector& location, FVector& outLocation, float& outFloorHeight)
+{
+	FNavLocation projectedLocation;
+	if (!navSystem->ProjectPointToNavigation(location, projectedLocation, searchingExtent, navData)) return false;
+
+	// Do a final line trace to adjust the Z of the nav-mesh as it sometimes is not set up to be flush with the surface.
+	outLocation = projectedLocation.Location;
+	FHitResult navMeshHeightError;
+	world->LineTraceSingleByObjectType(navMeshHeightError, outLocation, outLocation - FVector(0.0f, 0.0f, 10.0f), floorTypes, floorTraceParams);
+	// Otherwise if nothing is hit just use the nav meshes assumed location as it the next best option.
+	outFloorHeight = navMeshHeightError.bBlockingHit ? navMeshHeightError.Location.Z : outLocation.Z;
+	return true;
+}
+
+ANavigationData* AVRMovement::GetTeleportNavData()
+{
+	if (!teleportNavData.IsValid() && player)
+	{
+		UNavigationSystemV1* navSystem = Cast<UNavigationSystemV1>(GetWorld()->GetNavigationSystem());
+		if (navSystem) teleportNavData = navSystem->GetNavDataForProps(player->floatingMovement->GetNavAgentPropertiesRef());
+	}
+	return teleportNavData.Get();
+}
+
+void AVRMovement::OnNavigationGenerationFinished(ANavigationData* navData)
+{
+	// Any rebuilt tiles may have changed where the floor is, so forget every cached projection for the players nav data.
+	if (!teleportNavData.IsValid() || navData == teleportNavData.Get())
+	{
+		teleportNavCache.Clear();
+		if (teleportGrid.IsUsable())
 		{
-			// Do a final line trace to adjust the Z of the nav-mesh as it sometimes is not set up to be flush with the surface.
-			FHitResult navMeshHeightError;
-			FCollisionQueryParams floorTraceParams;
-			floorTraceParams.AddIgnoredActor(this);
-			floorTraceParams.AddIgnoredActor(player);
-			GetWorld()->LineTraceSingleByObjectType(navMeshHeightError, foundLocation, foundLocation - FVector(0.0f, 0.0f, 10.0f), teleportableTypes, floorTraceParams);
-			if (navMeshHeightError.bBlockingHit) location = navMeshHeightError.Location;
-			// Otherwise if nothing is hit just use the nav meshes assumed location as it the next best option.
-			else location = foundLocation;
-			return true;
+			UE_LOG(LogVRMovement, Log, TEXT("The nav mesh has been rebuilt, teleport locations will be projected onto the nav mesh instead of using the teleport grid."));
+			teleportGrid.MarkStale();
 		}
-		else return false;
 	}
-	else return false;
 }
 
 void AVRMovement::UpdateTeleportMaterials(bool valid)
@@ -846,22 +1149,20 @@ void AVRMovement::UpdateTeleportMaterials(bool valid)
 	FLinearColor newColor = validTeleportColor;
 	if (!valid) newColor = invalidTeleportColor;
 
-	// Adjust the materials of the spline and spline end mesh to the valid tp material.
-	teleportSplineEndMesh->SetVectorParameterValueOnMaterials("Color", FVector(newColor.R, newColor.G, newColor.B));
-	teleportRing->SetVectorParameterValueOnMaterials("Color", FVector(newColor.R, newColor.G, newColor.B));
-	teleportArrow->SetVectorParameterValueOnMaterials("Color", FVector(newColor.R, newColor.G, newColor.B));
-	for (USplineMeshComponent* splineMesh : splineMeshes)
-	{
-		splineMesh->SetVectorParameterValueOnMaterials("Color", FVector(newColor.R, newColor.G, newColor.B));
-	}
+	// Adjust the material shared by the arc, ring, arrow and end mesh, only when the color has changed as each write dirties its render state.
+	if (!teleportMAT || (teleportColorWritten && teleportColor == newColor)) return;
+	teleportMAT->SetVectorParameterValue("Color", newColor);
+	teleportColor = newColor;
+	teleportColorWritten = true;
+	INC_DWORD_STAT(STAT_TeleportMaterialWrites);
 }
 
 void AVRMovement::TeleportCameraFade()
 {
 	if (lastTeleportValid)
 	{
-		// If the teleport spline is still visible destroy it.
-		if (splineMeshes.Num() > 0) DestroyTeleportSpline();
+		// If the teleport spline is still visible hide it.
+		if (teleportArcShowing) HideTeleportSpline();
 
 		// Fade the camera.
 		if (playerController) playerController->PlayerCameraManager->StartCameraFade(0.0f, 1.0f, cameraFadeTimeToLast, teleportFadeColor, false, true);
@@ -877,8 +1178,8 @@ void AVRMovement::TeleportCameraFade()
 
 void AVRMovement::TeleportPlayer()
 {
-	// If the teleport spline is still visible destroy it.
-	if (splineMeshes.Num() > 0) DestroyTeleportSpline();
+	// If the teleport spline is still visible hide it.
+	if (teleportArcShowing) HideTeleportSpline();
 
 	// If in developer mode teleport capsule and raise from floor and teleport.
 	if (currentMovementMode == EVRMovementMode::Developer)
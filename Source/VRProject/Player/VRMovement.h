@@ -5,6 +5,12 @@
 #include "GameFramework/Actor.h"
 #include "NavigationData.h"
 #include "NavQueryFilter.h"
+#include "Player/TeleportArc.h"
+#include "Player/TeleportArcMesh.h"
+#include "Player/TeleportNavCache.h"
+#include "Player/TeleportGrid.h"
+#include "Player/GroundContact.h"
+#include "Async/Future.h"
 #include "Globals.h"
 #include "VRMovement.generated.h"
 
@@ -13,14 +19,15 @@ DECLARE_LOG_CATEGORY_EXTERN(LogVRMovement, Log, All);
 
 /** Declare classes used. */
 class USceneComponent;
-class USplineComponent;
 class UStaticMeshComponent;
-class UStaticMesh;
+class UProceduralMeshComponent;
 class UMaterialInterface;
 class UMaterialInstanceDynamic;
+class UMaterialParameterCollection;
 class AVRPlayer;
 class AVRHand;
 class APlayerController;
+class UNavigationSystemV1;
 class USoundBase;
 
 /** Different movement modes. */
@@ -54,6 +61,22 @@ enum class EVRInput : uint8
 	HideRight,
 };
 
+/** Result of projecting a teleport location onto the nav mesh off the game thread. */
+struct FTeleportProjection
+{
+	FVector query; /** The location that was projected. */
+	FVector projected; /** The point on the nav mesh. */
+	float floorHeight; /** Corrected floor height at the projected point. */
+	bool valid; /** Was the location on the nav mesh. */
+
+	FTeleportProjection()
+		: query(FVector::ZeroVector)
+		, projected(FVector::ZeroVector)
+		, floorHeight(0.0f)
+		, valid(false)
+	{}
+};
+
 /** The VRPawns Movement component class containing all virtual reality movement functionality.
  * NOTE: If movement mode is changed during runtime the SetupMovement function must be ran afterwards for the class to work correctly... */
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent), Blueprintable, BlueprintType, hidecategories = (Rendering, Replication, Input, Actor, LOD, Cooking))
@@ -67,10 +90,6 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
 	USceneComponent* scene;
 
-	/** Spline used to place the procedural mesh along usually a cylinder with no top or bottom polygons. */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
-	USplineComponent* teleportSpline;
-
 	/** Mesh used to show location to teleport to. */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
 	UStaticMeshComponent* teleportRing;
@@ -83,9 +102,9 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
 	UStaticMeshComponent* teleportSplineEndMesh;
 
-	/** Mesh to be procedurally placed along the teleport spline. */
+	/** Single mesh the teleport arc is drawn with, its vertices are rewritten in place each frame. */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
-	UStaticMesh* teleportSplineMesh;
+	UProceduralMeshComponent* teleportArcMesh;
 
 	/** Current type of movement mode. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement")
@@ -136,6 +155,32 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Teleport", meta = (ClampMin = "0.0", ClampMax = "100.0", UIMin = "0.0", UIMax = "100.0"))
 	float teleportHeight;
 
+	/** Most segments the teleport arc mesh can be drawn with, the size its vertex buffer is created at. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement|Teleport", meta = (ClampMin = "2", ClampMax = "128"))
+	int32 teleportArcSegments;
+
+	/** Cap on the teleport arc segments for each effects quality level from low to epic. Levels past the end use the last entry.
+	 * NOTE: Clamped to teleportArcSegments. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement|Teleport")
+	TArray<int32> teleportArcQualitySegments;
+
+	/** Max angle in degrees a teleport arc segment can stray from the true curve as seen from the camera. Near straight or distant parts of the arc use fewer segments. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement|Teleport", meta = (ClampMin = "0.01", ClampMax = "5.0"))
+	float teleportArcErrorAngle;
+
+	/** Number of sides around the teleport arc mesh. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement|Teleport", meta = (ClampMin = "3", ClampMax = "16"))
+	int32 teleportArcSides;
+
+	/** Radius of the teleport arc mesh. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement|Teleport", meta = (ClampMin = "0.1", ClampMax = "10.0"))
+	float teleportArcRadius;
+
+	/** Material shared by the teleport arc, ring, arrow and end mesh. Its Color parameter is set to the valid or invalid teleport color.
+	 * NOTE: If not set the teleport rings material is used. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement|Teleport")
+	UMaterialInterface* teleportMaterial;
+
 	/** Size of the dead zone for the teleport rotation arrow. NOTE: Clamped between 0 and 1. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Teleport", meta = (ClampMin = "0.0", UIMin = "0.0", ClampMax = "0.6", UIMax = "0.6"))
 	float teleportDeadzone;
@@ -152,6 +197,24 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Teleport", meta = (ClampMin = "0.0", UIMin = "100.0", ClampMax = "0.0", UIMax = "100.0"))
 	float teleportSearchDistance;
 
+	/** Size in cm of the cells teleport nav-mesh projections are cached in. Locations in the same cell share a projection. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement|Teleport", meta = (ClampMin = "1.0", ClampMax = "100.0"))
+	float teleportNavCacheCellSize;
+
+	/** Most cells of teleport nav-mesh projections kept before the least recently used is dropped. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement|Teleport", meta = (ClampMin = "1"))
+	int32 teleportNavCacheSize;
+
+	/** Validate teleport locations against the levels baked teleport grid when there is one, only projecting onto the nav mesh outside of it.
+	 * NOTE: Bake grids with the TeleportGrid commandlet. The grid is ignored once the nav mesh is rebuilt at runtime. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement|Teleport")
+	bool useTeleportGrid;
+
+	/** Trace the teleport arc and project onto the nav mesh off the game thread, showing the most recent completed result which is one frame behind the aim.
+	 * NOTE: Pipeline depth and latency are shown with "stat VRTeleport". */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Teleport")
+	bool pipelinedTeleport;
+
 	/** Move direction is relative to the camera where as if this is false move direction will be relative to world. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|WalkingMovement")
 	bool cameraMoveDirection;
@@ -188,6 +251,11 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|WalkingMovement")
 	UMaterialInterface* vingetteMATInstance;
 
+	/** Collection the vignettes opacity is written to as the scalar parameter "opacity", for vignette materials that read it from a collection.
+	 * NOTE: If not set the opacity is written to a material instance of the vignette material. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|WalkingMovement")
+	UMaterialParameterCollection* vignetteParameters;
+
 	/** Minimum offset from the center required to start movement, this is then checked against the max offset that determines speed. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|LeaningMovement", meta = (ClampMin = "0.0", ClampMax = "20.0", UIMin = "0.0", UIMax = "20.0"))
 	float minMovementOffsetRadius;
@@ -219,6 +287,7 @@ private:
 
 	bool firstMove;// Used to determine the first frame of movement.
 	bool inAir;// Is the player currently in the air.
+	FGroundContact groundContact; /** Ground state of the players feet for non-physics movement. */
 	FVector originalMovementLocation;
 	FVector lastMovementLocation;
 
@@ -231,7 +300,26 @@ private:
 	float teleportWidth;
 	FVector lastValidTeleportLocation;
 	FRotator teleportRotation;
-	TArray<class USplineMeshComponent*> splineMeshes;
+	FTeleportArc teleportArc; /** Traces the teleport arc and keeps last frames hit to speed up the next trace. */
+	FTeleportArcMesh teleportArcMeshData; /** Vertex data of the teleport arc mesh. */
+	TArray<FVector> arcPoints; /** Locations along the arc drawn this frame. */
+	TArray<FVector> arcDirections; /** Directions along the arc drawn this frame. */
+	bool teleportArcShowing; /** Is the teleport arc mesh visible. */
+	FTeleportNavCache teleportNavCache; /** Cached nav-mesh projections of teleport locations. */
+	TWeakObjectPtr<ANavigationData> teleportNavData; /** Nav data for the players agent, resolved once. */
+	FTeleportGrid teleportGrid; /** Baked teleport grid of the current level. */
+	AVRHand* pipelinedHand; /** Hand aiming the pipelined teleport. */
+	TFuture<FTeleportProjection> pendingProjection; /** Projection running on a worker. */
+	bool projectionPending; /** Is a projection running on a worker. */
+	uint64 queuedArcFrame; /** Frame the queued arc was aimed on. */
+	double queuedArcTime; /** Time the queued arc was aimed at. */
+	uint64 resolvedArcFrame; /** Frame the arc being shown was aimed on. */
+	double resolvedArcTime; /** Time the arc being shown was aimed at. */
+	FDelegateHandle postActorTickHandle; /** Handle of the post actor tick delegate collecting projections. */
+	UPROPERTY()
+	UMaterialInstanceDynamic* teleportMAT; /** Material instance shared by all the teleport meshes. */
+	FLinearColor teleportColor; /** Color last written to the teleport material. */
+	bool teleportColorWritten; /** Has a color been written to the current teleport material. */
 
 	/////////////////////////////////////////////////
 	//			     Vignette Vars.			       //
@@ -239,8 +327,10 @@ private:
 
 	UMaterialInstanceDynamic* vignetteMAT;
 	float lastVignetteOpacity;
-	FTimerHandle vignetteTimer;
 	bool canApplyVignette;
+	float vignetteTarget; /** Opacity the vignette is fading towards. */
+	float vignetteFadeOpacity; /** Opacity the current fade started from. */
+	float vignetteFadeTime; /** World time the current fade started at. */
 
 	/////////////////////////////////////////////////
 	//			   Development Vars.			   //
@@ -259,6 +349,9 @@ public:
 	/** Frame. */
 	virtual void Tick(float DeltaTime) override;
 
+	/** Stop collecting pipelined teleport results and wait for any still running. */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	/////////////////////////////////////////////////
 	//		  Movement or Other Functions.		   //
 	/////////////////////////////////////////////////
@@ -270,18 +363,26 @@ public:
 	/** Function to enable/disable the capsule collisions physics for gravity. */
 	void EnableCapsule(bool enable = true);
 
+	/** Pass the capsules contacts to the ground state so landing doesn't need a floor trace. Is binded so needs UFUNCTION. */
+	UFUNCTION()
+	void OnCapsuleHit(UPrimitiveComponent* hitComponent, AActor* otherActor, UPrimitiveComponent* otherComp, FVector normalImpulse, const FHitResult& hit);
+
 	/** Function to update the different types of vr movement depending on current mode selected, also ran on release execute code on release. */
 	void UpdateMovement(AVRHand* movementHand, bool released = false);
 
 	/** Function to update while the teleport button is down. */
 	void UpdateControllerMovement(AVRHand* movementHand);
 
-	/** Function to interpolate vignette opacity back to 1.0 (invisible). */
+	/** Function to fade vignette opacity back to 1.0 (invisible). */
 	UFUNCTION(BlueprintCallable, Category = "WalkingMovement")
 	void ResetVignette();
 
-	/** Interpolates the vignettes opacity value stored in the vignetteMAT variable to a specified target. */
-	void LerpVignette(float target);
+	/** Start fading the vignettes opacity towards a target from its current opacity, does nothing if already fading to the target. */
+	void FadeVignette(float target);
+
+	/** Evaluate the vignettes fade for this frame and write its opacity, hiding the vignette while it is fully transparent.
+	 * NOTE: The fade is an exponential decay towards the target at vignetteTransitionSpeed, so the opacity only depends on the time since the fade started. */
+	void UpdateVignette();
 
 	/////////////////////////////////////////////////
 	//			Teleporting Functions.			   //
@@ -290,16 +391,66 @@ public:
 	/** Function to update while the teleport button is down. */
 	void UpdateTeleport(AVRHand* movementHand);
 
+	/** Show the ring and arrow at a validated location or mark the teleport as invalid, depending on lastTeleportValid. */
+	void ShowTeleportLocation(AVRHand* movementHand, const FVector& location);
+
 	/** Returns weather or not the teleport spline has hit anything, also updated outLocation. */
 	bool CreateTeleportSpline(FTransform startTransform, FVector& outLocation);
 
-	/** Removes all spline meshes and hides any teleport components. */
-	void DestroyTeleportSpline();
+	/** Draw the short cancelled arc if the hand is aiming too close to straight up.
+	 * @Return true if the teleport was cancelled. */
+	bool DrawCancelledTeleportSpline(const FTransform& startTransform);
+
+	/** Draw the current teleport arc and its end mesh.
+	 * @Return true if the arc hit something, also updates outLocation. */
+	bool FinishTeleportSpline(FVector& outLocation);
+
+	/** @Return query params for the teleport arc, ignoring the player, the movement and both hands. */
+	FCollisionQueryParams GetTeleportArcParams() const;
+
+	/** Show last frames arc, start validating where it landed and queue this frames arc. */
+	void UpdatePipelinedTeleport(AVRHand* movementHand);
+
+	/** Validate where the arc landed using the grid or cache, or start projecting it on a worker. */
+	void BeginTeleportProjection(const FVector& location);
+
+	/** Show a validated teleport location and update the latency stats. */
+	void CompleteTeleportProjection(bool valid, const FVector& location);
+
+	/** Collect the projection started this frame once every actor has ticked. */
+	void OnWorldPostActorTick(UWorld* world, ELevelTick tickType, float deltaTime);
+
+	/** Drop the queued arc and wait for any running projection. */
+	void CancelPipelinedTeleport();
+
+	/** Hides the teleport arc mesh and any teleport components. */
+	void HideTeleportSpline();
+
+	/** Create the teleport arc mesh section and the material instance shared by the teleport meshes. Only creates them once. */
+	void CreateTeleportArcMesh();
+
+	/** Rewrite the teleport arc mesh along arcPoints and arcDirections and show it. */
+	void DrawTeleportArc();
+
+	/** @Return the cap on teleport arc segments for the current effects quality level. */
+	int32 GetTeleportArcSegmentCap() const;
 
 	/** Check if area is a valid teleport location. */
 	bool ValidateTeleportLocation(FVector& location);
 
-	/** Change the materials of all the teleport meshes. */
+	/** Project a location onto the nav mesh and correct its height to the floor. Safe to call off the game thread while the nav mesh isn't being rebuilt.
+	 * @Return true if the location is on the nav mesh, also updates outLocation and outFloorHeight. */
+	static bool ProjectTeleportLocation(UWorld* world, UNavigationSystemV1* navSystem, const ANavigationData* navData, const FVector& searchingExtent, const TArray<TEnumAsByte<EObjectTypeQuery>>& floorTypes, const FCollisionQueryParams& floorTraceParams, const FVector& location, FVector& outLocation, float& outFloorHeight);
+
+	/** @Return the nav data for the players agent, only looked up again if it has been removed. */
+	ANavigationData* GetTeleportNavData();
+
+	/** Clear the cached teleport projections and stop using the baked grid when the players nav data has been rebuilt. Is binded so needs UFUNCTION. */
+	UFUNCTION()
+	void OnNavigationGenerationFinished(ANavigationData* navData);
+
+	/** Change the color of the material shared by all the teleport meshes.
+	 * NOTE: Only writes the parameter when the color differs from the last one written. */
 	void UpdateTeleportMaterials(bool valid);
 
 	/** Fade the camera out -> teleport -> fade back in. */
@@ -5,6 +5,11 @@
 #include "Player/VRMovement.h"
 #include "Project/VRFunctionLibrary.h"
 #include "Project/EffectsContainer.h"
+#include "Project/CollisionClearanceComponent.h"
+#include "Project/HapticScheduler.h"
+#include "Project/TickTrace.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
 #include "Camera/CameraComponent.h"
 #include "MotionControllerComponent.h"
 #include "XRMotionControllerBase.h"
@@ -26,9 +31,21 @@
 #include "Materials/MaterialInstance.h"
 #include "ConstructorHelpers.h"
 #include "TimerManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
 
 DEFINE_LOG_CATEGORY(LogVRPlayer);
 
+/** Console command to print the tick graph of every player and capture the order they tick in on the next frame. */
+static FAutoConsoleCommandWithWorld dumpTickGraphCommand(
+	TEXT("VR.TickGraph"),
+	TEXT("Print the tick functions and prerequisites of the VR players, hands, handles and movement, then record the order they tick in and the input to physics latency on the next frame."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* world)
+	{
+		for (TActorIterator<AVRPlayer> it(world); it; ++it) it->DumpTickGraph();
+		FVRTickTrace::CaptureNextFrame();
+	}));
+
 AVRPlayer::AVRPlayer()
 {
 	PrimaryActorTick.bCanEverTick = true;
@@ -72,6 +89,12 @@ AVRPlayer::AVRPlayer()
 	// Setup the effects container.
 	pawnEffects = CreateDefaultSubobject<UEffectsContainer>(TEXT("PawnEffects"));
 
+	// Setup the collision clearance component used to re-enable collision on the head and hands.
+	collisionClearance = CreateDefaultSubobject<UCollisionClearanceComponent>(TEXT("CollisionClearance"));
+
+	// Setup the haptic scheduler used to play feedback on the controllers.
+	hapticScheduler = CreateDefaultSubobject<UHapticScheduler>(TEXT("HapticScheduler"));
+
 	// Add post update ticking function to this actor.
 	postTick.bCanEverTick = false;
 	postTick.Target = this;
@@ -87,6 +110,8 @@ AVRPlayer::AVRPlayer()
 	thumbL = false;
 	thumbR = false;
 	centeredLocation = FVector::ZeroVector;
+	inputSourceType = EVRInputSourceType::Device;
+	recordInput = false;
 	debug = false;
 }
 
@@ -94,6 +119,15 @@ void AVRPlayer::PostInitializeComponents()
 {
 	Super::PostInitializeComponents();
 
+	// Allow the input source to be overridden from the command line, so the player can be driven headless without any VR hardware.
+	FString recordingOverride;
+	if (FParse::Value(FCommandLine::Get(), TEXT("VRInputRecording="), recordingOverride))
+	{
+		inputSourceType = EVRInputSourceType::Recorded;
+		inputRecordingFile = recordingOverride;
+	}
+	else if (FParse::Param(FCommandLine::Get(), TEXT("VRInputSynthetic"))) inputSourceType = EVRInputSourceType::Synthetic;
+
 	// Spawn movementComponent class.
 	if (movementClass && !movement)
 	{
@@ -110,8 +144,8 @@ void AVRPlayer::PostInitializeComponents()
 		movement->SetOwner(this);
 
 #if WITH_EDITOR
-		// Enable developer mode if the HMD headset is enabled.
-		if (!UHeadMountedDisplayFunctionLibrary::IsHeadMountedDisplayEnabled())
+		// Enable developer mode if the HMD headset is enabled. Recorded and synthetic input is never in developer mode as it drives the hands itself.
+		if (inputSourceType == EVRInputSourceType::Device && !UHeadMountedDisplayFunctionLibrary::IsHeadMountedDisplayEnabled())
 		{
 			movement->currentMovementMode = EVRMovementMode::Developer;
 			devModeActive = true;
@@ -152,6 +186,36 @@ void AVRPlayer::BeginPlay()
 	leftHand->SetupHand(rightHand, this, devModeActive);
 	rightHand->SetupHand(leftHand, this, devModeActive);
 
+	// Update the head handle target and the movement after this frames input and hands.
+	headHandle->AddTickPrerequisiteActor(this);
+	movement->AddTickPrerequisiteActor(leftHand);
+	movement->AddTickPrerequisiteActor(rightHand);
+
+	// Create the input source unless one was already given.
+	if (!inputSource)
+	{
+		switch (inputSourceType)
+		{
+		case EVRInputSourceType::Recorded:
+			inputSource = MakeUnique<FRecordedVRInputSource>(inputRecordingFile);
+			break;
+		case EVRInputSourceType::Synthetic:
+			inputSource = MakeUnique<FSyntheticVRInputSource>();
+			break;
+		default:
+			inputSource = MakeUnique<FDeviceVRInputSource>(hmdDevice, leftHand->controller, rightHand->controller);
+			break;
+		}
+
+#if WITH_EDITOR
+		if (debug) UE_LOG(LogVRPlayer, Warning, TEXT("The player %s is sampling input from the %s input source."), *GetName(), inputSource->GetName());
+#endif
+	}
+
+	// Resolve the collision presets used when toggling collision on the head collider.
+	physicsPreset = FCollisionPreset::Find("PhysicsActor");
+	physicsOverlapPreset = FCollisionPreset::Find("PhysicsActorOverlap");
+
 	// Setup physics handling of the head collider.
 	headCollider->SetSimulatePhysics(true);
 	headHandle->CreateJointAndFollowLocationWithRotation(headCollider, (UPrimitiveComponent*)camera, NAME_None, camera->GetComponentLocation(), camera->GetComponentRotation());
@@ -165,13 +229,29 @@ void AVRPlayer::BeginPlay()
 	UHeadMountedDisplayFunctionLibrary::SetTrackingOrigin(EHMDTrackingOrigin::Floor);
 }
 
+void AVRPlayer::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	Super::EndPlay(EndPlayReason);
+
+	// Save any recorded input so it can be played back by the recorded input source.
+	if (recordInput && recordedInput.Num() > 0)
+	{
+		if (FRecordedVRInputSource::SaveRecording(inputRecordingFile, recordedInput))
+		{
+			UE_LOG(LogVRPlayer, Log, TEXT("Saved %i frames of input to the recording %s."), recordedInput.Num(), *inputRecordingFile);
+		}
+		else UE_LOG(LogVRPlayer, Error, TEXT("The player %s could not save its input recording to %s."), *GetName(), *inputRecordingFile);
+		recordedInput.Empty();
+	}
+}
+
 void AVRPlayer::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
-	// Update the hands tick function from this class.
-	if (leftHand && leftHand->active) leftHand->Tick(DeltaTime);
-	if (rightHand && rightHand->active) rightHand->Tick(DeltaTime);
+	// Sample this frames input before anything reads it. The hands tick after this with their own tick functions.
+	UpdateInputSnapshot();
+	FVRTickTrace::Record(this, FVRTickTrace::EStage::InputSampled);
 }
 
 void AVRPlayer::PostUpdateTick(float DeltaTime)
@@ -187,6 +267,10 @@ void AVRPlayer::PostUpdateTick(float DeltaTime)
 
 	// Update the current collision properties based from the tracking of the HMD and then each hand to prevent physics actors being affected by repositioning these components.
 	if (!devModeActive) UpdateHardwareTrackingState();
+
+	// Finish any tick order capture.
+	FVRTickTrace::Record(this, FVRTickTrace::EStage::PostPhysics);
+	FVRTickTrace::EndFrame();
 }
 
 void AVRPlayer::Teleported()
@@ -205,25 +289,126 @@ void AVRPlayer::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
 {
 	Super::SetupPlayerInputComponent(PlayerInputComponent);
 
-	// Player pawn action bindings.
-	PlayerInputComponent->BindAction("TriggerLeft", IE_Pressed, this, &AVRPlayer::TriggerLeftPressed);
-	PlayerInputComponent->BindAction("TriggerLeft", IE_Released, this, &AVRPlayer::TriggerLeftReleased);
-	PlayerInputComponent->BindAction("TriggerRight", IE_Pressed, this, &AVRPlayer::TriggerRightPressed);
-	PlayerInputComponent->BindAction("TriggerRight", IE_Released, this, &AVRPlayer::TriggerRightReleased);
-	PlayerInputComponent->BindAction("ThumbMiddleL", IE_Pressed, this, &AVRPlayer::ThumbLeftPressed);
-	PlayerInputComponent->BindAction("ThumbMiddleL", IE_Released, this, &AVRPlayer::ThumbLeftReleased);
-	PlayerInputComponent->BindAction("ThumbMiddleR", IE_Pressed, this, &AVRPlayer::ThumbRightPressed);
-	PlayerInputComponent->BindAction("ThumbMiddleR", IE_Released, this, &AVRPlayer::ThumbRightReleased);
-
-	// Player pawn axis bindings.
-	PlayerInputComponent->BindAxis("TriggerL", this, &AVRPlayer::TriggerLeftAxis);
-	PlayerInputComponent->BindAxis("TriggerR", this, &AVRPlayer::TriggerRightAxis);
-	PlayerInputComponent->BindAxis("ThumbstickLeft_X", this, &AVRPlayer::ThumbstickLeftX);
-	PlayerInputComponent->BindAxis("ThumbstickLeft_Y", this, &AVRPlayer::ThumbstickLeftY);
-	PlayerInputComponent->BindAxis("ThumbstickRight_X", this, &AVRPlayer::ThumbstickRightX);
-	PlayerInputComponent->BindAxis("ThumbstickRight_Y", this, &AVRPlayer::ThumbstickRightY);
-	PlayerInputComponent->BindAxis("SqueezeL", this, &AVRPlayer::SqueezeL);
-	PlayerInputComponent->BindAxis("SqueezeR", this, &AVRPlayer::SqueezeR);
+	// Player pawn action bindings. These only write the button state into the live input, the input events are dispatched from the snapshot.
+	PlayerInputComponent->BindAction<FVRButtonBinding>("TriggerLeft", IE_Pressed, this, &AVRPlayer::SetButtonState, EVRInputButton::TriggerLeft, true);
+	PlayerInputComponent->BindAction<FVRButtonBinding>("TriggerLeft", IE_Released, this, &AVRPlayer::SetButtonState, EVRInputButton::TriggerLeft, false);
+	PlayerInputComponent->BindAction<FVRButtonBinding>("TriggerRight", IE_Pressed, this, &AVRPlayer::SetButtonState, EVRInputButton::TriggerRight, true);
+	PlayerInputComponent->BindAction<FVRButtonBinding>("TriggerRight", IE_Released, this, &AVRPlayer::SetButtonState, EVRInputButton::TriggerRight, false);
+	PlayerInputComponent->BindAction<FVRButtonBinding>("ThumbMiddleL", IE_Pressed, this, &AVRPlayer::SetButtonState, EVRInputButton::ThumbLeft, true);
+	PlayerInputComponent->BindAction<FVRButtonBinding>("ThumbMiddleL", IE_Released, this, &AVRPlayer::SetButtonState, EVRInputButton::ThumbLeft, false);
+	PlayerInputComponent->BindAction<FVRButtonBinding>("ThumbMiddleR", IE_Pressed, this, &AVRPlayer::SetButtonState, EVRInputButton::ThumbRight, true);
+	PlayerInputComponent->BindAction<FVRButtonBinding>("ThumbMiddleR", IE_Released, this, &AVRPlayer::SetButtonState, EVRInputButton::ThumbRight, false);
+
+	// Player pawn axis bindings. Bound without callbacks as their values are read into the live input at the start of each frame.
+	PlayerInputComponent->BindAxis("TriggerL");
+	PlayerInputComponent->BindAxis("TriggerR");
+	PlayerInputComponent->BindAxis("ThumbstickLeft_X");
+	PlayerInputComponent->BindAxis("ThumbstickLeft_Y");
+	PlayerInputComponent->BindAxis("ThumbstickRight_X");
+	PlayerInputComponent->BindAxis("ThumbstickRight_Y");
+	PlayerInputComponent->BindAxis("SqueezeL");
+	PlayerInputComponent->BindAxis("SqueezeR");
+}
+
+void AVRPlayer::SetButtonState(EVRInputButton button, bool pressed)
+{
+	switch (button)
+	{
+	case EVRInputButton::TriggerLeft:
+		liveInput.left.triggerPressed = pressed;
+		liveInput.left.triggerEdges++;
+		break;
+	case EVRInputButton::TriggerRight:
+		liveInput.right.triggerPressed = pressed;
+		liveInput.right.triggerEdges++;
+		break;
+	case EVRInputButton::ThumbLeft:
+		liveInput.left.thumbPressed = pressed;
+		liveInput.left.thumbEdges++;
+		break;
+	case EVRInputButton::ThumbRight:
+		liveInput.right.thumbPressed = pressed;
+		liveInput.right.thumbEdges++;
+		break;
+	}
+}
+
+void AVRPlayer::UpdateInputSnapshot()
+{
+	// Read the axis bindings, processed by the player controller before this pawn ticks.
+	if (InputComponent)
+	{
+		liveInput.left.trigger = InputComponent->GetAxisValue("TriggerL");
+		liveInput.right.trigger = InputComponent->GetAxisValue("TriggerR");
+		liveInput.left.thumbstick = FVector2D(InputComponent->GetAxisValue("ThumbstickLeft_X"), InputComponent->GetAxisValue("ThumbstickLeft_Y"));
+		liveInput.right.thumbstick = FVector2D(InputComponent->GetAxisValue("ThumbstickRight_X"), InputComponent->GetAxisValue("ThumbstickRight_Y"));
+		liveInput.left.squeeze = InputComponent->GetAxisValue("SqueezeL");
+		liveInput.right.squeeze = InputComponent->GetAxisValue("SqueezeR");
+	}
+	liveInput.timeStamp = GetWorld()->GetTimeSeconds();
+	liveInput.frame = (int32)GFrameCounter;
+
+	// Sample the source into a fresh snapshot keeping the last one to know each buttons state before this frames edges.
+	if (!inputSource)
+	{
+		liveInput.left.ClearEdges();
+		liveInput.right.ClearEdges();
+		return;
+	}
+	lastInputSnapshot = inputSnapshot;
+	inputSource->Sample(liveInput, inputSnapshot);
+	liveInput.left.ClearEdges();
+	liveInput.right.ClearEdges();
+	if (recordInput) recordedInput.Add(inputSnapshot);
+
+	// Send the new input to the hands and movement.
+	DispatchInputSnapshot();
+}
+
+void AVRPlayer::DispatchInputSnapshot()
+{
+	const FVRHandInput& left = inputSnapshot.left;
+	const FVRHandInput& right = inputSnapshot.right;
+
+	// Button presses and releases, including any that started and ended within the frame.
+	DispatchButton(lastInputSnapshot.left.triggerPressed, left.triggerPressed, left.triggerEdges, &AVRPlayer::TriggerLeftPressed, &AVRPlayer::TriggerLeftReleased);
+	DispatchButton(lastInputSnapshot.right.triggerPressed, right.triggerPressed, right.triggerEdges, &AVRPlayer::TriggerRightPressed, &AVRPlayer::TriggerRightReleased);
+	DispatchButton(lastInputSnapshot.left.thumbPressed, left.thumbPressed, left.thumbEdges, &AVRPlayer::ThumbLeftPressed, &AVRPlayer::ThumbLeftReleased);
+	DispatchButton(lastInputSnapshot.right.thumbPressed, right.thumbPressed, right.thumbEdges, &AVRPlayer::ThumbRightPressed, &AVRPlayer::ThumbRightReleased);
+
+	// Axis values are sent every frame.
+	TriggerLeftAxis(left.trigger);
+	TriggerRightAxis(right.trigger);
+	ThumbstickLeftX(left.thumbstick.X);
+	ThumbstickLeftY(left.thumbstick.Y);
+	ThumbstickRightX(right.thumbstick.X);
+	ThumbstickRightY(right.thumbstick.Y);
+	SqueezeL(left.squeeze);
+	SqueezeR(right.squeeze);
+}
+
+void AVRPlayer::DispatchButton(bool wasPressed, bool pressed, int32 edges, void (AVRPlayer::*onPressed)(), void (AVRPlayer::*onReleased)())
+{
+	// An odd number of edges must change the state, make the count agree in case the source missed one. e.g. a recording looping back to its start.
+	if ((edges % 2 == 1) != (wasPressed != pressed)) edges++;
+
+	// Edges alternate between press and release starting from the last state.
+	bool state = wasPressed;
+	for (int32 i = 0; i < edges; i++)
+	{
+		state = !state;
+		(this->*(state ? onPressed : onReleased))();
+	}
+}
+
+void AVRPlayer::SetInputSource(TUniquePtr<IVRInputSource>&& newSource)
+{
+	if (!newSource) return;
+	inputSource = MoveTemp(newSource);
+
+#if WITH_EDITOR
+	if (debug) UE_LOG(LogVRPlayer, Warning, TEXT("The player %s is sampling input from the %s input source."), *GetName(), inputSource->GetName());
+#endif
 }
 
 void AVRPlayer::TriggerLeftPressed()
@@ -555,7 +740,7 @@ void AVRPlayer::TriggerRightAxis(float val)
 void AVRPlayer::UpdateHardwareTrackingState()
 {
 	// Only allow the collision to be enabled on the player while the headset is being tracked.
-	bool trackingHMD = UHeadMountedDisplayFunctionLibrary::IsDeviceTracking(hmdDevice);
+	bool trackingHMD = inputSnapshot.hmdTracked;
 	if (trackingHMD)
 	{
 		if (!foundHMD)
@@ -668,32 +853,41 @@ void AVRPlayer::ActivateCollision(bool enable)
 {
 	if (enable)
 	{
-		FTimerDelegate timerDel;
-		timerDel.BindUFunction(this, FName("CollisionDelay"));
-		GetWorld()->GetTimerManager().SetTimer(headColDelay, timerDel, 0.05f, true);
+		// Re-enable the head Collider collision once it is no longer overlapping any blocking physics bodies.
+		collisionClearance->WaitForClearance(headCollider, actorsToIgnore, FComponentCleared::CreateUObject(this, &AVRPlayer::HeadCollisionCleared));
 		collisionEnabled = true;
 	}
 	else
 	{
 		// Disable the head Collider collision along with both hands.
-		headCollider->SetCollisionProfileName("PhysicsActorOverlap");
+		collisionClearance->CancelClearance(headCollider);
+		physicsOverlapPreset.ApplyTo(headCollider);
 		collisionEnabled = false;
 	}
 }
 
-void AVRPlayer::CollisionDelay()
+void AVRPlayer::HeadCollisionCleared(UPrimitiveComponent* clearedComp)
 {
-	// Check if the given collisionComponent is currently overlapping a blocking physics collision.
-	TArray<UPrimitiveComponent*> overlappingComps;
-	bool overlapping = UVRFunctionLibrary::ComponentOverlapComponentsByChannel(headCollider, headCollider->GetComponentTransform(), ECC_PhysicsBody, actorsToIgnore, overlappingComps, true);
+	// No longer overlapping so re-enable the collision on the head Collider to query and physics.
+	physicsPreset.ApplyTo(headCollider);
+}
 
-	// If no longer overlapping re-enable the collision on the head Collider to query and physics.
-	if (!overlapping)
+void AVRPlayer::DumpTickGraph()
+{
+	UE_LOG(LogTickTrace, Log, TEXT("Tick graph for %s:"), *GetName());
+	FVRTickTrace::PrintTickFunction(TEXT("Player input snapshot"), PrimaryActorTick);
+	FVRTickTrace::PrintTickFunction(TEXT("Head handle"), headHandle->PrimaryComponentTick);
+	for (AVRHand* hand : { leftHand, rightHand })
 	{
-		// Stop this function once the collision is re-enabled.
-		headCollider->SetCollisionProfileName("PhysicsActor");
-		GetWorld()->GetTimerManager().ClearTimer(headColDelay);
+		if (!hand) continue;
+		FString handName = hand->GetName();
+		FVRTickTrace::PrintTickFunction(*(handName + TEXT(" controller")), hand->controller->PrimaryComponentTick);
+		FVRTickTrace::PrintTickFunction(*handName, hand->PrimaryActorTick);
+		FVRTickTrace::PrintTickFunction(*(handName + TEXT(" hand handle")), hand->handHandle->PrimaryComponentTick);
+		FVRTickTrace::PrintTickFunction(*(handName + TEXT(" grab handle")), hand->grabHandle->PrimaryComponentTick);
 	}
+	if (movement) FVRTickTrace::PrintTickFunction(TEXT("Movement"), movement->PrimaryActorTick);
+	FVRTickTrace::PrintTickFunction(TEXT("Player post update"), postTick);
 }
 
 UEffectsContainer* AVRPlayer::GetPawnEffects()
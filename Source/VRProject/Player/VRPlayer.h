@@ -6,6 +6,8 @@
 #include "GameFramework/Pawn.h"
 #include "GameFramework/FloatingPawnMovement.h"
 #include "IIdentifiableXRDevice.h"
+#include "Project/CollisionPresets.h"
+#include "Player/VRInputSnapshot.h"
 #include "Globals.h"
 #include "VRPlayer.generated.h"
 
@@ -24,6 +26,11 @@ class AVRHand;
 class UInputComponent;
 class UMaterial;
 class UEffectsContainer;
+class UCollisionClearanceComponent;
+class UHapticScheduler;
+
+/** Action binding that writes a button state into the players live input. */
+DECLARE_DELEGATE_TwoParams(FVRButtonBinding, EVRInputButton, bool);
 
 /** Post update ticking function integration. 
  *  NOTE: Important for checking the tracking state of the HMD and hands. */
@@ -100,10 +107,35 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Pawn")
 	UEffectsContainer* pawnEffects;
 
+	/** Component that re-enables collision on the head and hands once they are no longer inside blocking physics bodies. */
+	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, Category = "Pawn")
+	UCollisionClearanceComponent* collisionClearance;
+
+	/** Component that merges haptic feedback requests from the hands and interactables into one device update per controller per frame. */
+	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, Category = "Pawn")
+	UHapticScheduler* hapticScheduler;
+
 	/** VR Physics handle component to handle the head collider. */
 	UPROPERTY(VisibleDefaultsOnly, BlueprintReadWrite)
 	UVRPhysicsHandleComponent* headHandle;
 
+	/** Where the input snapshot is sampled from each frame. Recorded and synthetic sources run without any VR hardware or SteamVR.
+	 * NOTE: Overridden from the command line with -VRInputRecording=<file> or -VRInputSynthetic. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Pawn|Input")
+	EVRInputSourceType inputSourceType;
+
+	/** Recording played back by the recorded input source and written to while recording input. Relative paths are from the projects saved directory. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Pawn|Input")
+	FString inputRecordingFile;
+
+	/** Record every input snapshot while playing and save them to the input recording file on end play. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Pawn|Input")
+	bool recordInput;
+
+	/** Input of both hands and the HMD for this frame. Sampled at the start of the frame before the hands, movement and interactables update. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Pawn|Input")
+	FVRInputSnapshot inputSnapshot;
+
 	/** Enable any debug messages for this class. */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Pawn")
 	bool debug;
@@ -124,11 +156,32 @@ public:
 private:
 
 	bool collisionEnabled; /** This classes components are blocking physics simulated components. */
-	FTimerHandle headColDelay; /** Timer handle for the collision delay when the collision will be re-enabled on the head Collider. Also some timer handles for the hands. */
+	FCollisionPreset physicsPreset, physicsOverlapPreset; /** Collision presets the head Collider switches between when its collision is enabled or disabled. */
 	FXRDeviceId hmdDevice; /** Device ID for the current HMD device that is being used. */
 	AVRHand* movingHand; /** The hand that is currently initiating movement for the VRPawn. */
 	FVector centeredLocation; /** The centered location to reset tracking to. */
 	FRotator centeredRotation; /** The centered rotation to reset tracking to. */
+	TUniquePtr<IVRInputSource> inputSource; /** Source the input snapshot is sampled from. */
+	FVRInputSnapshot liveInput; /** Button and axis state written by the input bindings, used by the device input source. */
+	FVRInputSnapshot lastInputSnapshot; /** The previous frames snapshot, used to find button presses and releases. */
+	TArray<FVRInputSnapshot> recordedInput; /** Snapshots recorded this session while recording input. */
+
+	/** Write a button state from the action bindings into the live input. */
+	void SetButtonState(EVRInputButton button, bool pressed);
+
+	/** Read the axis bindings into the live input, sample the input source and dispatch the new snapshot to the hands and movement. */
+	void UpdateInputSnapshot();
+
+	/** Send a buttons presses and releases in the order they happened, alternating from its state in the last snapshot.
+	 * @Param wasPressed, Was the button held in the last snapshot.
+	 * @Param pressed, Is the button held in this snapshot.
+	 * @Param edges, Presses and releases counted since the last snapshot.
+	 * @Param onPressed, Event called for each press.
+	 * @Param onReleased, Event called for each release. */
+	void DispatchButton(bool wasPressed, bool pressed, int32 edges, void (AVRPlayer::*onPressed)(), void (AVRPlayer::*onReleased)());
+
+	/** Send button presses/releases and axis values from the current snapshot to the input events. */
+	void DispatchInputSnapshot();
 
 protected:
 
@@ -138,6 +191,9 @@ protected:
 	/** Level start. */
 	virtual void BeginPlay() override;
 
+	/** Level end. */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	/** Setup pawn input. */
 	virtual void SetupPlayerInputComponent(UInputComponent* PlayerInputComponent) override;
 
@@ -200,9 +256,15 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Pawn|Collision")
 	void ActivateCollision(bool enable);
 
-	/** Looping function every 0.1 seconds checking if the head Collider is currently overlapping physics etc. If not re-enable collision, until then loop and check. */
-	UFUNCTION(Category = "Pawn|Collision")
-	void CollisionDelay();
+	/** Called by the collision clearance component once the head Collider is no longer overlapping any blocking physics bodies to re-enable its collision. */
+	void HeadCollisionCleared(UPrimitiveComponent* clearedComp);
+
+	/** Replace the source the input snapshot is sampled from. Used to drive the player from native code, e.g. benchmarks.
+	 * @Param newSource, The new input source, ignored if null. */
+	void SetInputSource(TUniquePtr<IVRInputSource>&& newSource);
+
+	/** Print the tick functions and prerequisites of this player, its hands, handles and movement. Used by the VR.TickGraph console command. */
+	void DumpTickGraph();
 
 	/** Get the effects container from the pawn. So hands and other interactables can obtain default effects for rumbling or audio feedback. */
 	UFUNCTION(BlueprintCallable, Category = "Pawn|Collision")
@@ -212,6 +274,8 @@ public:
 	/**					Input events.                  */
 	/////////////////////////////////////////////////////
 
+	// NOTE: Dispatched from the input snapshot each frame rather than bound directly to the input component.
+
 	UFUNCTION(Category = "Pawn|Input")
 	void TriggerLeftPressed();
 
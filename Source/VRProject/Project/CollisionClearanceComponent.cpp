@@ -0,0 +1,145 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Project/CollisionClearanceComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Components/ShapeComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Globals.h"
+
+DEFINE_LOG_CATEGORY(LogCollisionClearance);
+
+UCollisionClearanceComponent::UCollisionClearanceComponent()
+{
+	// Only tick while there are requests waiting to be cleared.
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+
+	// Initialise default variables.
+	clearanceChannel = ECC_PhysicsBody;
+	debug = false;
+}
+
+void UCollisionClearanceComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	float currentTime = GetWorld()->GetTimeSeconds();
+	for (int32 i = requests.Num() - 1; i >= 0; i--)
+	{
+		// Remove requests for components that have since been destroyed.
+		FClearanceRequest& request = requests[i];
+		if (!request.component.IsValid() || request.component->IsPendingKill())
+		{
+			requests.RemoveAtSwap(i);
+			continue;
+		}
+
+		// Only check once the minimum delay has passed and the last query has returned.
+		if (currentTime >= request.readyTime && !request.pendingQuery.IsValid()) IssueQuery(request);
+	}
+
+	// Stop ticking if every request was removed.
+	if (requests.Num() == 0) SetComponentTickEnabled(false);
+}
+
+void UCollisionClearanceComponent::WaitForClearance(UPrimitiveComponent* comp, const TArray<AActor*>& ignoredActors, FComponentCleared onCleared, float minDelay)
+{
+	CHECK_RETURN(LogCollisionClearance, !comp, "The clearance component %s, cannot wait for a null component.", *GetName());
+
+	// Reuse any request already pending for this component, dropping its in-flight query.
+	int32 index = FindRequest(comp);
+	if (index == INDEX_NONE) index = requests.AddDefaulted();
+	FClearanceRequest& request = requests[index];
+	request.component = comp;
+	request.onCleared = onCleared;
+	request.pendingQuery = FTraceHandle();
+	request.readyTime = GetWorld()->GetTimeSeconds() + (minDelay < 0.0f ? 0.1f : minDelay);
+
+	// Ignore the component itself along with the given actors.
+	request.queryParams = FCollisionQueryParams(SCENE_QUERY_STAT(CollisionClearance));
+	request.queryParams.AddIgnoredComponent(comp);
+	request.queryParams.AddIgnoredActors(ignoredActors);
+
+	// Start ticking to issue the first query.
+	SetComponentTickEnabled(true);
+
+#if WITH_EDITOR
+	if (debug) UE_LOG(LogCollisionClearance, Warning, TEXT("The component %s is waiting for clearance."), *comp->GetName());
+#endif
+}
+
+void UCollisionClearanceComponent::CancelClearance(UPrimitiveComponent* comp)
+{
+	// Any query still in flight for the request is ignored once it returns.
+	int32 index = FindRequest(comp);
+	if (index != INDEX_NONE) requests.RemoveAtSwap(index);
+}
+
+bool UCollisionClearanceComponent::IsWaitingForClearance(UPrimitiveComponent* comp) const
+{
+	return FindRequest(comp) != INDEX_NONE;
+}
+
+void UCollisionClearanceComponent::IssueQuery(FClearanceRequest& request)
+{
+	// Shape components can be queried with their own shape and rotation, anything else uses its world bounding box.
+	UPrimitiveComponent* comp = request.component.Get();
+	FVector queryLocation = comp->Bounds.Origin;
+	FQuat queryRotation = FQuat::Identity;
+	if (comp->IsA<UShapeComponent>())
+	{
+		queryLocation = comp->GetComponentLocation();
+		queryRotation = comp->GetComponentQuat();
+	}
+
+	// Results are delivered at the start of the next frame.
+	FOverlapDelegate overlapDelegate = FOverlapDelegate::CreateUObject(this, &UCollisionClearanceComponent::OverlapFinished);
+	request.pendingQuery = GetWorld()->AsyncOverlapByChannel(queryLocation, queryRotation, clearanceChannel, comp->GetCollisionShape(), request.queryParams, FCollisionResponseParams::DefaultResponseParam, &overlapDelegate);
+}
+
+void UCollisionClearanceComponent::OverlapFinished(const FTraceHandle& handle, FOverlapDatum& data)
+{
+	// Find the request this query was issued for, it may have been cancelled or replaced since.
+	int32 index = requests.IndexOfByPredicate([&handle](const FClearanceRequest& request) { return request.pendingQuery == handle; });
+	if (index == INDEX_NONE) return;
+	requests[index].pendingQuery = FTraceHandle();
+
+	// Check for any overlap that would block the component once its collision is re-enabled.
+	for (const FOverlapResult& overlap : data.OutOverlaps)
+	{
+		UPrimitiveComponent* overlappingComp = overlap.Component.Get();
+		if (overlappingComp && overlappingComp->GetCollisionResponseToChannel(clearanceChannel) == ECR_Block && overlappingComp->GetCollisionEnabled() == ECollisionEnabled::QueryAndPhysics)
+		{
+			return;
+		}
+	}
+
+	// Nothing is blocking, report the component as clear.
+	ClearRequest(index);
+}
+
+void UCollisionClearanceComponent::ClearRequest(int32 index)
+{
+	// Remove the request before running its callbacks so they can safely request clearance again.
+	FClearanceRequest request = requests[index];
+	requests.RemoveAtSwap(index);
+	if (requests.Num() == 0) SetComponentTickEnabled(false);
+
+	// Report the cleared component.
+	UPrimitiveComponent* clearedComp = request.component.Get();
+	if (clearedComp)
+	{
+		request.onCleared.ExecuteIfBound(clearedComp);
+		OnComponentCleared.Broadcast(clearedComp);
+
+#if WITH_EDITOR
+		if (debug) UE_LOG(LogCollisionClearance, Warning, TEXT("The component %s is clear and can collide again."), *clearedComp->GetName());
+#endif
+	}
+}
+
+int32 UCollisionClearanceComponent::FindRequest(UPrimitiveComponent* comp) const
+{
+	return requests.IndexOfByPredicate([comp](const FClearanceRequest& request) { return request.component.Get() == comp; });
+}
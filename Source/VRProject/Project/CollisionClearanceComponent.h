@@ -0,0 +1,98 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "WorldCollision.h"
+#include "CollisionClearanceComponent.generated.h"
+
+/** Declare log type for this class. */
+DECLARE_LOG_CATEGORY_EXTERN(LogCollisionClearance, Log, All);
+
+/** Define classes used. */
+class UPrimitiveComponent;
+
+/** Native callback for when a component waiting for clearance is no longer overlapping any blocking physics bodies. */
+DECLARE_DELEGATE_OneParam(FComponentCleared, UPrimitiveComponent*);
+
+/** Blueprint event for when a component waiting for clearance is no longer overlapping any blocking physics bodies. */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnComponentCleared, UPrimitiveComponent*, clearedComponent);
+
+/** Pending clearance request for a single component. */
+struct FClearanceRequest
+{
+	TWeakObjectPtr<UPrimitiveComponent> component; /** The component waiting to be clear of blocking physics bodies. */
+	FCollisionQueryParams queryParams; /** Query parameters holding the ignored actors and component for this request. */
+	FComponentCleared onCleared; /** Callback to run once the component is clear. */
+	FTraceHandle pendingQuery; /** Handle of the async overlap currently in flight for this request. */
+	float readyTime; /** World time before which the component is never reported as clear. */
+
+	FClearanceRequest()
+		: queryParams(SCENE_QUERY_STAT(CollisionClearance))
+		, readyTime(0.0f)
+	{}
+};
+
+/** Component that waits for colliders to be clear of blocking physics bodies before reporting they can collide again. Used for re-enabling collision
+ * on the hands and head after teleporting, releasing or regaining tracking.
+ * NOTE: Issues at most one async overlap per request per frame, results are consumed the following frame. Only ticks while requests are pending. */
+UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
+class VRPROJECT_API UCollisionClearanceComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Called for every component that becomes clear, after its native callback has ran. */
+	UPROPERTY(BlueprintAssignable, Category = "Collision")
+	FOnComponentCleared OnComponentCleared;
+
+	/** Collision channel that colliders are checked against for blocking overlaps. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Collision")
+	TEnumAsByte<ECollisionChannel> clearanceChannel;
+
+	/** Enable any debug messages for this class. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Collision")
+	bool debug;
+
+private:
+
+	TArray<FClearanceRequest> requests; /** Components currently waiting to be clear. */
+
+	/** Async overlap result callback.
+	 * @Param handle, The handle of the finished query.
+	 * @Param data, The overlap results of the finished query. */
+	void OverlapFinished(const FTraceHandle& handle, FOverlapDatum& data);
+
+	/** Issue an async overlap for the given request at the components current location. */
+	void IssueQuery(FClearanceRequest& request);
+
+	/** Remove the request at the given index, report it as cleared and stop ticking if there is nothing left to wait for. */
+	void ClearRequest(int32 index);
+
+	/** Find the index of the request for the given component. */
+	int32 FindRequest(UPrimitiveComponent* comp) const;
+
+public:
+
+	/** Constructor */
+	UCollisionClearanceComponent();
+
+	/** Frame */
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	/** Start waiting for a component to be clear of blocking collision. Replaces any request already pending for the same component.
+	 * @Param comp, The component to wait for.
+	 * @Param ignoredActors, Actors to ignore while checking for blocking overlaps.
+	 * @Param onCleared, Native callback to run once the component is clear.
+	 * @Param minDelay, Minimum time in seconds to wait before the component can be reported as clear, negative waits for the default of 0.1 seconds. */
+	void WaitForClearance(UPrimitiveComponent* comp, const TArray<AActor*>& ignoredActors, FComponentCleared onCleared, float minDelay = 0.0f);
+
+	/** Stop waiting for the given component without running its callback. */
+	UFUNCTION(BlueprintCallable, Category = "Collision")
+	void CancelClearance(UPrimitiveComponent* comp);
+
+	/** @Return true if the given component is currently waiting to be clear. */
+	UFUNCTION(BlueprintCallable, Category = "Collision")
+	bool IsWaitingForClearance(UPrimitiveComponent* comp) const;
+};
@@ -0,0 +1,47 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Project/CollisionPresets.h"
+#include "Engine/CollisionProfile.h"
+#include "Components/PrimitiveComponent.h"
+
+DEFINE_LOG_CATEGORY(LogCollisionPresets);
+
+TMap<FName, FCollisionPreset> FCollisionPreset::presets;
+
+FCollisionPreset FCollisionPreset::Find(FName profile)
+{
+	// Return the cached preset if the profile has already been resolved.
+	if (const FCollisionPreset* foundPreset = presets.Find(profile)) return *foundPreset;
+
+	// Resolve the profile from the project collision settings.
+	FCollisionPreset newPreset;
+	newPreset.profileName = profile;
+	FCollisionResponseTemplate profileTemplate;
+	if (UCollisionProfile::Get()->GetProfileTemplate(profile, profileTemplate))
+	{
+		newPreset.collisionEnabled = profileTemplate.CollisionEnabled;
+		newPreset.objectType = profileTemplate.ObjectType;
+		newPreset.responses = profileTemplate.ResponseToChannels;
+		newPreset.valid = true;
+	}
+	else UE_LOG(LogCollisionPresets, Error, TEXT("The collision profile %s could not be found, presets using it will not be applied."), *profile.ToString());
+
+	// Cache and return the preset.
+	presets.Add(profile, newPreset);
+	return newPreset;
+}
+
+void FCollisionPreset::ApplyTo(UPrimitiveComponent* comp) const
+{
+	if (!valid || !comp) return;
+
+	// Each part applied updates the bodies filter data, so a single differing part is applied on its own and anything more applies the whole profile at once.
+	bool objectTypeDiffers = comp->GetCollisionObjectType() != objectType;
+	bool responsesDiffer = !(comp->GetCollisionResponseToChannels() == responses);
+	bool enabledDiffers = comp->GetCollisionEnabled() != collisionEnabled;
+	int32 differing = (int32)objectTypeDiffers + (int32)responsesDiffer + (int32)enabledDiffers;
+	if (differing > 1) comp->SetCollisionProfileName(profileName);
+	else if (objectTypeDiffers) comp->SetCollisionObjectType(objectType);
+	else if (responsesDiffer) comp->SetCollisionResponseToChannels(responses);
+	else if (enabledDiffers) comp->SetCollisionEnabled(collisionEnabled);
+}
@@ -0,0 +1,44 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+
+/** Declare log type for the collision presets. */
+DECLARE_LOG_CATEGORY_EXTERN(LogCollisionPresets, Log, All);
+
+/** Define classes used. */
+class UPrimitiveComponent;
+
+/** A collision profile resolved once into its collision enabled state, object type and channel responses. Applying a preset only changes
+ * the parts of a components collision that differ from it, instead of resolving the profile name and rebuilding every part of the filter data.
+ * NOTE: Presets are cached by profile name the first time they are found, resolve them in begin play to keep the lookup out of hot paths. */
+struct VRPROJECT_API FCollisionPreset
+{
+	FName profileName; /** Name of the collision profile this preset was resolved from. */
+	ECollisionEnabled::Type collisionEnabled; /** Collision enabled state of the profile. */
+	TEnumAsByte<ECollisionChannel> objectType; /** Object type of the profile. */
+	FCollisionResponseContainer responses; /** Responses to every channel of the profile. */
+	bool valid; /** Was the profile found. */
+
+	FCollisionPreset()
+		: profileName(NAME_None)
+		, collisionEnabled(ECollisionEnabled::NoCollision)
+		, objectType(ECC_WorldStatic)
+		, valid(false)
+	{}
+
+	/** Find the preset for a collision profile, resolving and caching it on first use.
+	 * @Param profile, The name of the collision profile in the project settings.
+	 * @Return The resolved preset, invalid if no profile exists with the given name. */
+	static FCollisionPreset Find(FName profile);
+
+	/** Apply this preset to a component, only updating the collision enabled state, object type or responses if just one of them differs,
+	 * otherwise applying the whole profile so the filter data is only rebuilt once.
+	 * @Param comp, The component to apply this preset to. */
+	void ApplyTo(UPrimitiveComponent* comp) const;
+
+private:
+
+	static TMap<FName, FCollisionPreset> presets; /** Presets resolved so far, by profile name. */
+};
@@ -0,0 +1,148 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Project/HapticScheduler.h"
+#include "Haptics/HapticFeedbackEffect_Base.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+#include "Globals.h"
+
+DEFINE_LOG_CATEGORY(LogHapticScheduler);
+
+UHapticScheduler::UHapticScheduler()
+{
+	// Flush after the hands, interactables and physics have submitted their requests for this frame.
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+	PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
+
+	// Initialise default variables.
+	owningController = nullptr;
+	intensityTolerance = 0.05f;
+	queueDepth = 0;
+	peakQueueDepth = 0;
+	droppedRequests = 0;
+	deviceUpdates = 0;
+	debug = false;
+}
+
+void UHapticScheduler::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Get the controller to play haptic effects through.
+	owningController = GetWorld()->GetFirstPlayerController();
+}
+
+void UHapticScheduler::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	// Send the winning request of each controller to the device.
+	FlushChannel(EControllerHand::Left);
+	FlushChannel(EControllerHand::Right);
+
+	// Update stats and sleep until the next request.
+	peakQueueDepth = FMath::Max(peakQueueDepth, queueDepth);
+	queueDepth = 0;
+	SetComponentTickEnabled(false);
+}
+
+bool UHapticScheduler::SubmitFeedback(EControllerHand hand, UHapticFeedbackEffect_Base* feedback, float intensity, bool replace, int32 priority)
+{
+	queueDepth++;
+
+	// Drop requests with no effect to play.
+	if (!feedback)
+	{
+		droppedRequests++;
+		return false;
+	}
+
+	FHapticChannel& channel = channels[GetChannelIndex(hand)];
+	if (channel.hasPending)
+	{
+		// Merge with the request already waiting this frame. Higher priority wins, then a replacing or stronger request.
+		bool wins = priority > channel.pendingPriority || (priority == channel.pendingPriority && (replace || intensity > channel.pendingIntensity));
+		droppedRequests++;
+		if (!wins) return false;
+	}
+	else if (IsDevicePlaying(hand))
+	{
+		// Never interrupt a higher priority effect, and only interrupt an equal priority effect if replacing or stronger.
+		if (priority < channel.playingPriority || (priority == channel.playingPriority && !replace && intensity <= channel.playingIntensity))
+		{
+			droppedRequests++;
+			return false;
+		}
+
+		// Skip restarting the effect that is already playing at roughly the same intensity.
+		if (feedback == channel.playingEffect && priority == channel.playingPriority && FMath::IsNearlyEqual(intensity, channel.playingIntensity, intensityTolerance))
+		{
+			droppedRequests++;
+			return false;
+		}
+	}
+
+	// Store as the request to play at the end of this frame.
+	channel.pendingEffect = feedback;
+	channel.pendingIntensity = intensity;
+	channel.pendingPriority = priority;
+	channel.hasPending = true;
+	SetComponentTickEnabled(true);
+	return true;
+}
+
+void UHapticScheduler::FlushChannel(EControllerHand hand)
+{
+	FHapticChannel& channel = channels[GetChannelIndex(hand)];
+	if (!channel.hasPending) return;
+	channel.hasPending = false;
+
+	// Find the controller again if it has been lost.
+	if (!owningController) owningController = GetWorld()->GetFirstPlayerController();
+	CHECK_RETURN(LogHapticScheduler, !owningController, "The haptic scheduler %s could not play feedback as there is no owning player controller.", *GetName());
+
+	// Play the winning effect.
+	owningController->PlayHapticEffect(channel.pendingEffect, hand, channel.pendingIntensity, false);
+	channel.playingEffect = channel.pendingEffect;
+	channel.playingIntensity = channel.pendingIntensity;
+	channel.playingPriority = channel.pendingPriority;
+	deviceUpdates++;
+
+#if WITH_EDITOR
+	if (debug) UE_LOG(LogHapticScheduler, Log, TEXT("Playing %s on the %s controller at intensity %f."), *channel.playingEffect->GetName(), hand == EControllerHand::Left ? TEXT("left") : TEXT("right"), channel.playingIntensity);
+#endif
+}
+
+int32 UHapticScheduler::GetChannelIndex(EControllerHand hand)
+{
+	return hand == EControllerHand::Left ? 0 : 1;
+}
+
+bool UHapticScheduler::IsDevicePlaying(EControllerHand hand) const
+{
+	if (!owningController) return false;
+	if (hand == EControllerHand::Left) return owningController->ActiveHapticEffect_Left.IsValid();
+	return owningController->ActiveHapticEffect_Right.IsValid();
+}
+
+bool UHapticScheduler::IsPlayingFeedback(EControllerHand hand) const
+{
+	return channels[GetChannelIndex(hand)].hasPending || IsDevicePlaying(hand);
+}
+
+float UHapticScheduler::GetCurrentFeedbackIntensity(EControllerHand hand) const
+{
+	// Return the pending intensity first as it will replace whatever is currently playing.
+	const FHapticChannel& channel = channels[GetChannelIndex(hand)];
+	if (channel.hasPending) return channel.pendingIntensity;
+	if (IsDevicePlaying(hand)) return channel.playingIntensity;
+	return 0.0f;
+}
+
+void UHapticScheduler::ResetStats()
+{
+	peakQueueDepth = 0;
+	droppedRequests = 0;
+	deviceUpdates = 0;
+}
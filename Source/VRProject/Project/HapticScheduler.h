@@ -0,0 +1,122 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "InputCoreTypes.h"
+#include "HapticScheduler.generated.h"
+
+/** Declare log type for this class. */
+DECLARE_LOG_CATEGORY_EXTERN(LogHapticScheduler, Log, All);
+
+/** Define classes used. */
+class UHapticFeedbackEffect_Base;
+class APlayerController;
+
+/** Haptic state for a single controller. */
+struct FHapticChannel
+{
+	UHapticFeedbackEffect_Base* pendingEffect; /** Effect that won this frames merge, played on the next flush. */
+	float pendingIntensity; /** Intensity of the pending effect. */
+	int32 pendingPriority; /** Priority of the pending effect. */
+	bool hasPending; /** Is there an effect waiting to be sent to the device. */
+
+	UHapticFeedbackEffect_Base* playingEffect; /** Effect last sent to the device. */
+	float playingIntensity; /** Intensity of the effect last sent to the device. */
+	int32 playingPriority; /** Priority of the effect last sent to the device. */
+
+	FHapticChannel()
+		: pendingEffect(nullptr)
+		, pendingIntensity(0.0f)
+		, pendingPriority(0)
+		, hasPending(false)
+		, playingEffect(nullptr)
+		, playingIntensity(0.0f)
+		, playingPriority(0)
+	{}
+};
+
+/** Component that accepts haptic feedback requests from every source and merges them by priority and intensity so each controller
+ * receives at most one device update per frame.
+ * NOTE: Flushes in the post update work tick group and only ticks on frames where a request was accepted. */
+UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
+class VRPROJECT_API UHapticScheduler : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Requests for the same effect as the one already playing are skipped if their intensity is within this tolerance of it. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Haptics", meta = (ClampMin = "0.0", UIMin = "0.0", UIMax = "1.0"))
+	float intensityTolerance;
+
+	/** Requests submitted since the last flush. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Haptics|Stats")
+	int32 queueDepth;
+
+	/** The largest number of requests submitted within a single frame. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Haptics|Stats")
+	int32 peakQueueDepth;
+
+	/** Requests that were rejected or lost a merge to a stronger or higher priority request. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Haptics|Stats")
+	int32 droppedRequests;
+
+	/** Number of haptic effects actually sent to the controllers. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Haptics|Stats")
+	int32 deviceUpdates;
+
+	/** Enable any debug messages for this class. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Haptics")
+	bool debug;
+
+private:
+
+	UPROPERTY()
+	APlayerController* owningController; /** The player controller haptic effects are played through. */
+	FHapticChannel channels[2]; /** Haptic state for the left and right controllers. */
+
+	/** @Return the index into channels for the given hand. */
+	static int32 GetChannelIndex(EControllerHand hand);
+
+	/** @Return true if the device is still playing an effect on the given hand. */
+	bool IsDevicePlaying(EControllerHand hand) const;
+
+	/** Send the pending effect of a channel to its controller. */
+	void FlushChannel(EControllerHand hand);
+
+protected:
+
+	/** Level Start */
+	virtual void BeginPlay() override;
+
+public:
+
+	/** Constructor */
+	UHapticScheduler();
+
+	/** Frame */
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	/** Submit a haptic effect to be played on the given controller at the end of this frame.
+	 * @Param hand, The controller to play the effect on.
+	 * @Param feedback, The haptic effect to play.
+	 * @Param intensity, The intensity of the effect to play.
+	 * @Param replace, Should replace the current haptic effect playing? If false it is only replaced by a stronger or higher priority effect.
+	 * @Param priority, Requests with a higher priority always win a merge regardless of intensity.
+	 * @Return true if the request is currently the one that will be played, false if it was dropped. */
+	UFUNCTION(BlueprintCallable, Category = "Haptics")
+	bool SubmitFeedback(EControllerHand hand, UHapticFeedbackEffect_Base* feedback, float intensity = 1.0f, bool replace = false, int32 priority = 0);
+
+	/** @Return true if the given controller is playing or about to play a haptic effect. */
+	UFUNCTION(BlueprintCallable, Category = "Haptics")
+	bool IsPlayingFeedback(EControllerHand hand) const;
+
+	/** @Return the intensity of the effect playing or about to play on the given controller, 0 if there is none. */
+	UFUNCTION(BlueprintCallable, Category = "Haptics")
+	float GetCurrentFeedbackIntensity(EControllerHand hand) const;
+
+	/** Reset the peak queue depth, dropped requests and device update counters. */
+	UFUNCTION(BlueprintCallable, Category = "Haptics|Stats")
+	void ResetStats();
+};
@@ -0,0 +1,105 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Project/PoseHistory.h"
+
+FPoseHistory::FPoseHistory()
+{
+	head = -1;
+	count = 0;
+}
+
+void FPoseHistory::AddSample(double time, const FTransform& pose)
+{
+	// Ignore samples that are not newer than the last, they would break the fit.
+	if (count > 0 && time <= samples[head].time) return;
+
+	// Overwrite the oldest sample.
+	head = (head + 1) % capacity;
+	samples[head].time = time;
+	samples[head].location = pose.GetLocation();
+	samples[head].rotation = pose.GetRotation();
+	count = FMath::Min(count + 1, capacity);
+}
+
+void FPoseHistory::Reset()
+{
+	head = -1;
+	count = 0;
+}
+
+const FPoseSample& FPoseHistory::GetSample(int32 index) const
+{
+	check(index >= 0 && index < count);
+	return samples[(head - index + capacity) % capacity];
+}
+
+bool FPoseHistory::EstimateVelocity(int32 sampleCount, FVector& linearVelocity, FVector& angularVelocity) const
+{
+	linearVelocity = FVector::ZeroVector;
+	angularVelocity = FVector::ZeroVector;
+	sampleCount = FMath::Min(sampleCount, count);
+	if (sampleCount < 2) return false;
+
+	// Fit relative to the newest sample to keep the values small. Rotations are converted into rotation vectors from the newest rotation.
+	const FPoseSample& newest = GetSample(0);
+	const FQuat newestInverse = newest.rotation.Inverse();
+	float times[capacity];
+	FVector locations[capacity], rotations[capacity];
+	float meanTime = 0.0f;
+	FVector meanLocation = FVector::ZeroVector, meanRotation = FVector::ZeroVector;
+	for (int i = 0; i < sampleCount; i++)
+	{
+		const FPoseSample& sample = GetSample(i);
+		times[i] = sample.time - newest.time;
+		locations[i] = sample.location - newest.location;
+
+		// Take the shortest path so the rotation vectors don't flip between samples.
+		FQuat deltaRotation = sample.rotation * newestInverse;
+		if (deltaRotation.W < 0.0f) deltaRotation = deltaRotation * -1.0f;
+		FVector axis;
+		float angle;
+		deltaRotation.ToAxisAndAngle(axis, angle);
+		rotations[i] = axis * angle;
+
+		meanTime += times[i];
+		meanLocation += locations[i];
+		meanRotation += rotations[i];
+	}
+	meanTime /= sampleCount;
+	meanLocation /= sampleCount;
+	meanRotation /= sampleCount;
+
+	// Least squares slope of each component over time.
+	float timeVariance = 0.0f;
+	FVector locationCovariance = FVector::ZeroVector, rotationCovariance = FVector::ZeroVector;
+	for (int i = 0; i < sampleCount; i++)
+	{
+		float timeOffset = times[i] - meanTime;
+		timeVariance += timeOffset * timeOffset;
+		locationCovariance += (locations[i] - meanLocation) * timeOffset;
+		rotationCovariance += (rotations[i] - meanRotation) * timeOffset;
+	}
+	if (timeVariance <= SMALL_NUMBER) return false;
+
+	linearVelocity = locationCovariance / timeVariance;
+	angularVelocity = FMath::RadiansToDegrees(rotationCovariance / timeVariance);
+	return true;
+}
+
+FTransform FPoseHistory::PredictPose(double time, int32 sampleCount) const
+{
+	if (count == 0) return FTransform::Identity;
+
+	// Without a velocity estimate the newest sample is the best guess.
+	const FPoseSample& newest = GetSample(0);
+	FVector linearVelocity, angularVelocity;
+	if (!EstimateVelocity(sampleCount, linearVelocity, angularVelocity)) return FTransform(newest.rotation, newest.location);
+
+	// Extrapolate from the newest sample along the estimated velocities.
+	float deltaTime = time - newest.time;
+	FVector predictedLocation = newest.location + (linearVelocity * deltaTime);
+	FVector rotationVector = FMath::DegreesToRadians(angularVelocity) * deltaTime;
+	float angle = rotationVector.Size();
+	FQuat predictedRotation = angle > SMALL_NUMBER ? FQuat(rotationVector / angle, angle) * newest.rotation : newest.rotation;
+	return FTransform(predictedRotation, predictedLocation);
+}
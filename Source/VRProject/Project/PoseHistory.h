@@ -0,0 +1,66 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+#include "CoreMinimal.h"
+
+/** A single timestamped pose saved in the pose history. */
+struct FPoseSample
+{
+	double time;
+	FVector location;
+	FQuat rotation;
+
+	FPoseSample()
+	{
+		time = 0.0;
+		location = FVector::ZeroVector;
+		rotation = FQuat::Identity;
+	}
+};
+
+/** Fixed size ring buffer of timestamped poses. Used to estimate velocities with a least squares fit over the last few samples
+ * and to extrapolate the pose to a future time. NOTE: Never allocates, the oldest sample is overwritten once the buffer is full. */
+class VRPROJECT_API FPoseHistory
+{
+public:
+
+	/** Maximum amount of samples stored. */
+	static const int32 capacity = 16;
+
+	/** Constructor. */
+	FPoseHistory();
+
+	/** Add a new pose to the history. Samples with a time older or equal to the newest sample are ignored.
+	 * @Param time, The time in seconds the pose was sampled.
+	 * @Param pose, The transform to save. */
+	void AddSample(double time, const FTransform& pose);
+
+	/** Remove all samples from the history. */
+	void Reset();
+
+	/** @Return The amount of samples in the history. */
+	int32 Num() const { return count; }
+
+	/** Get a sample from the history.
+	 * @Param index, 0 being the newest sample and Num() - 1 being the oldest. */
+	const FPoseSample& GetSample(int32 index) const;
+
+	/** Estimate the linear and angular velocity using a least squares fit of the newest samples.
+	 * @Param sampleCount, The amount of samples to fit. Clamped between 2 and the amount of samples in the history.
+	 * @Param linearVelocity, The estimated linear velocity in units per second.
+	 * @Param angularVelocity, The estimated angular velocity in world space as axis * degrees per second.
+	 * @Return false if there are not enough samples to estimate a velocity. */
+	bool EstimateVelocity(int32 sampleCount, FVector& linearVelocity, FVector& angularVelocity) const;
+
+	/** Extrapolate the pose to the given time using the estimated velocities.
+	 * @Param time, The time in seconds to predict the pose at.
+	 * @Param sampleCount, The amount of samples to fit when estimating the velocities.
+	 * @Return The predicted pose, or the newest sample if there are not enough samples to predict with. */
+	FTransform PredictPose(double time, int32 sampleCount) const;
+
+private:
+
+	FPoseSample samples[capacity]; /** Sample storage. */
+	int32 head; /** Index of the newest sample. */
+	int32 count; /** Amount of valid samples. */
+};
@@ -0,0 +1,183 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Project/TeleportGridCommandlet.h"
+#include "Player/VRMovement.h"
+#include "Player/TeleportGrid.h"
+#include "Engine/World.h"
+#include "NavigationSystem.h"
+#include "NavigationData.h"
+#include "HAL/FileManager.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+#include "Globals.h"
+
+DEFINE_LOG_CATEGORY(LogTeleportGridCommandlet);
+
+UTeleportGridCommandlet::UTeleportGridCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UTeleportGridCommandlet::Main(const FString& Params)
+{
+	// Read the teleport settings from the movement class the player spawns, or the native defaults.
+	const AVRMovement* movement = GetDefault<AVRMovement>();
+	FString movementClassPath;
+	if (FParse::Value(*Params, TEXT("MovementClass="), movementClassPath))
+	{
+		UClass* movementClass = LoadClass<AVRMovement>(nullptr, *movementClassPath);
+		CHECK_OBJECT_RETURN(LogTeleportGridCommandlet, !movementClass, 1, "Could not load the movement class %s.", *movementClassPath);
+		movement = movementClass->GetDefaultObject<AVRMovement>();
+	}
+	float cellSize = 25.0f;
+	FParse::Value(*Params, TEXT("CellSize="), cellSize);
+	cellSize = FMath::Max(cellSize, 1.0f);
+
+	// Bake the requested levels, or every level in the levels folder.
+	TArray<FString> mapNames;
+	FString mapList;
+	if (FParse::Value(*Params, TEXT("Maps="), mapList)) mapList.ParseIntoArray(mapNames, TEXT("+"));
+	else
+	{
+		IFileManager::Get().FindFiles(mapNames, *FPaths::Combine(FPaths::ProjectContentDir(), TEXT("Levels"), TEXT("*.umap")), true, false);
+		for (FString& mapName : mapNames)
+		{
+			mapName = FPaths::GetBaseFilename(mapName);
+		}
+	}
+
+	int32 failed = 0;
+	for (const FString& mapName : mapNames)
+	{
+		if (!BakeMap(mapName, movement, cellSize)) failed++;
+	}
+	UE_LOG(LogTeleportGridCommandlet, Display, TEXT("Baked %i of %i teleport grids."), mapNames.Num() - failed, mapNames.Num());
+	return failed > 0 ? 1 : 0;
+}
+
+bool UTeleportGridCommandlet::BakeMap(const FString& mapName, const AVRMovement* movement, float cellSize)
+{
+	FString packageName = FString::Printf(TEXT("/Game/Levels/%s"), *mapName);
+	UPackage* package = LoadPackage(nullptr, *packageName, LOAD_None);
+	UWorld* world = package ? UWorld::FindWorldInPackage(package) : nullptr;
+	CHECK_RETURN_FALSE(LogTeleportGridCommandlet, !world, "Could not load the level %s.", *packageName);
+
+	// Initialise the world with collision and its navigation so it can be traced and the nav mesh built.
+	world->WorldType = EWorldType::Editor;
+	world->AddToRoot();
+	if (!world->bIsWorldInitialized)
+	{
+		UWorld::InitializationValues initValues;
+		initValues.RequiresHitProxies(false).ShouldSimulatePhysics(false).EnableTraceCollision(true).CreateNavigation(false).CreateAISystem(false).AllowAudioPlayback(false).CreatePhysicsScene(true);
+		world->InitWorld(initValues);
+	}
+	FNavigationSystem::AddNavigationSystemToWorld(*world, FNavigationSystemRunMode::EditorMode);
+	world->UpdateWorldComponents(true, false);
+	UNavigationSystemV1* navSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(world);
+	if (navSystem) navSystem->Build();
+
+	bool baked = BakeWorld(world, mapName, movement, cellSize);
+
+	// Release the level before loading the next.
+	world->RemoveFromRoot();
+	world->CleanupWorld();
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	return baked;
+}
+
+bool UTeleportGridCommandlet::BakeWorld(UWorld* world, const FString& mapName, const AVRMovement* movement, float cellSize)
+{
+	// Find the nav data of the movement's agent.
+	UNavigationSystemV1* navSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(world);
+	CHECK_RETURN_FALSE(LogTeleportGridCommandlet, !navSystem, "%s has no navigation system.", *mapName);
+	const TArray<FNavDataConfig>& agents = navSystem->GetSupportedAgents();
+	CHECK_RETURN_FALSE(LogTeleportGridCommandlet, !agents.IsValidIndex(movement->agentID), "The agentID %i is out of bounds.", movement->agentID);
+	const FNavAgentProperties& agent = agents[movement->agentID];
+	ANavigationData* navData = navSystem->GetNavDataForProps(agent);
+	CHECK_RETURN_FALSE(LogTeleportGridCommandlet, !navData, "%s has no nav mesh for the teleport agent.", *mapName);
+	CHECK_RETURN_FALSE(LogTeleportGridCommandlet, movement->teleportableTypes.Num() == 0, "The movement has no teleportable types, pass the players movement blueprint with -MovementClass.");
+
+	// Only the area covered by navigation can be teleported to.
+	FBox navBounds(ForceInit);
+	for (const FNavigationBounds& bounds : navSystem->GetNavigationBounds())
+	{
+		navBounds += bounds.AreaBox;
+	}
+	CHECK_RETURN_FALSE(LogTeleportGridCommandlet, !navBounds.IsValid, "%s has no navigation bounds.", *mapName);
+
+	FTeleportGridHeader header;
+	header.originX = navBounds.Min.X;
+	header.originY = navBounds.Min.Y;
+	header.cellSize = cellSize;
+	header.sizeX = FMath::CeilToInt((navBounds.Max.X - navBounds.Min.X) / cellSize);
+	header.sizeY = FMath::CeilToInt((navBounds.Max.Y - navBounds.Min.Y) / cellSize);
+	header.agentRadius = agent.AgentRadius;
+	header.agentHeight = agent.AgentHeight;
+	header.searchDistance = movement->teleportSearchDistance;
+
+	// Trace down the centre of each cell through every teleportable surface, keeping the projected point and corrected floor height of each that projects
+	// onto the nav mesh and marking those that don't as invalid. Only cells with surfaces are stored, as spans of neighbouring cells along each row.
+	TArray<uint32> rowStarts;
+	TArray<FTeleportGridSpan> spans;
+	TArray<uint32> columnStarts;
+	TArray<FTeleportGridFloor> floors;
+	rowStarts.Reserve(header.sizeY + 1);
+	FCollisionObjectQueryParams floorTypes(movement->teleportableTypes);
+	FCollisionQueryParams floorTraceParams(SCENE_QUERY_STAT(TeleportGridBake), false);
+	FVector searchingExtent = FVector(movement->teleportSearchDistance);
+	TArray<FHitResult> surfaces;
+	for (int32 y = 0; y < header.sizeY; y++)
+	{
+		rowStarts.Add(spans.Num());
+		for (int32 x = 0; x < header.sizeX; x++)
+		{
+			FVector cellCentre = FVector(header.originX + (x + 0.5f) * cellSize, header.originY + (y + 0.5f) * cellSize, 0.0f);
+			world->LineTraceMultiByObjectType(surfaces, FVector(cellCentre.X, cellCentre.Y, navBounds.Max.Z), FVector(cellCentre.X, cellCentre.Y, navBounds.Min.Z), floorTypes, floorTraceParams);
+			int32 cellStart = floors.Num();
+			for (const FHitResult& surface : surfaces)
+			{
+				// Validate the same way teleporting does, projecting onto the nav mesh and correcting its height to the floor.
+				// NOTE: Projections that move out of the cell, like near the edge of the nav mesh, are marked as snapped as that is where teleporting would move to.
+				FTeleportGridFloor floor = { surface.Location.X, surface.Location.Y, surface.Location.Z, 0 };
+				FNavLocation projectedLocation;
+				if (navSystem->ProjectPointToNavigation(surface.Location + surface.ImpactNormal, projectedLocation, searchingExtent, navData))
+				{
+					FVector foundLocation = projectedLocation.Location;
+					FHitResult floorHit;
+					world->LineTraceSingleByObjectType(floorHit, foundLocation, foundLocation - FVector(0.0f, 0.0f, 10.0f), floorTypes, floorTraceParams);
+					floor = { foundLocation.X, foundLocation.Y, floorHit.bBlockingHit ? floorHit.Location.Z : foundLocation.Z, FTeleportGridFloor::validFlag };
+					int32 foundX = FMath::FloorToInt((foundLocation.X - header.originX) / cellSize);
+					int32 foundY = FMath::FloorToInt((foundLocation.Y - header.originY) / cellSize);
+					if (foundX != x || foundY != y) floor.flags |= FTeleportGridFloor::snappedFlag;
+				}
+
+				// Skip floors already found in this cell.
+				bool duplicate = false;
+				for (int32 i = cellStart; i < floors.Num() && !duplicate; i++)
+				{
+					duplicate = floors[i].flags == floor.flags && FMath::IsNearlyEqual(floors[i].z, floor.z, 1.0f);
+				}
+				if (!duplicate) floors.Add(floor);
+			}
+
+			// Cells without any surfaces are left out, extending the rows last span if it ends at this cell or starting a new one.
+			if (floors.Num() == cellStart) continue;
+			if (spans.Num() > (int32)rowStarts.Last() && spans.Last().endX == x) spans.Last().endX++;
+			else spans.Add({ x, x + 1, (uint32)columnStarts.Num() });
+			columnStarts.Add(cellStart);
+		}
+	}
+	rowStarts.Add(spans.Num());
+	columnStarts.Add(floors.Num());
+	header.spanCount = spans.Num();
+	header.columnCount = columnStarts.Num() - 1;
+	header.floorCount = floors.Num();
+
+	CHECK_RETURN_FALSE(LogTeleportGridCommandlet, !FTeleportGrid::Save(mapName, header, rowStarts, spans, columnStarts, floors), "Could not write the teleport grid %s.", *FTeleportGrid::GetGridPath(mapName));
+	UE_LOG(LogTeleportGridCommandlet, Display, TEXT("Baked %s: %i x %i cells, %i occupied in %i spans, %i floors."), *mapName, header.sizeX, header.sizeY, header.columnCount, header.spanCount, header.floorCount);
+	return true;
+}
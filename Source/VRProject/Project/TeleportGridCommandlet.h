@@ -0,0 +1,43 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "TeleportGridCommandlet.generated.h"
+
+/** Declare log type for the teleport grid commandlet. */
+DECLARE_LOG_CATEGORY_EXTERN(LogTeleportGridCommandlet, Log, All);
+
+/** Define classes used. */
+class UWorld;
+class AVRMovement;
+
+/** Bakes the teleport grid of each level by sampling its teleportable surfaces and nav mesh for the movement's nav agent.
+ * Run headless with: UE4Editor-Cmd.exe VRProject.uproject -run=TeleportGrid [-Maps=DrivingLevel+WeaponDemoLevel] [-CellSize=25] [-MovementClass=/Game/...BP_Movement.BP_Movement_C]
+ * NOTE: Without -Maps every level in Content/Levels is baked. Rebake whenever a level or the movement's teleport settings change. */
+UCLASS()
+class VRPROJECT_API UTeleportGridCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Constructor. */
+	UTeleportGridCommandlet();
+
+	/** Bake the grid of every requested level. */
+	virtual int32 Main(const FString& Params) override;
+
+private:
+
+	/** Load a level, build its navigation and bake its grid.
+	 * @Param mapName, Short name of the level in Content/Levels.
+	 * @Param movement, Movement defaults to read the nav agent and teleport settings from.
+	 * @Param cellSize, Size of each grid cell in cm.
+	 * @Return true if the grid was written. */
+	bool BakeMap(const FString& mapName, const AVRMovement* movement, float cellSize);
+
+	/** Sample the grid of a loaded world and write it.
+	 * @Return true if the grid was written. */
+	bool BakeWorld(UWorld* world, const FString& mapName, const AVRMovement* movement, float cellSize);
+};
@@ -0,0 +1,93 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Project/TickTrace.h"
+#include "Engine/EngineBaseTypes.h"
+#include "HAL/PlatformTime.h"
+#include "Globals.h"
+
+DEFINE_LOG_CATEGORY(LogTickTrace);
+
+bool FVRTickTrace::capturing = false;
+uint64 FVRTickTrace::captureFrame = 0;
+TArray<FVRTickTrace::FEntry> FVRTickTrace::entries;
+
+void FVRTickTrace::CaptureNextFrame()
+{
+	entries.Reset();
+	captureFrame = GFrameCounter + 1;
+	capturing = true;
+}
+
+void FVRTickTrace::RecordInternal(const UObject* object, EStage stage)
+{
+	if (GFrameCounter != captureFrame) return;
+	FEntry& entry = entries.AddDefaulted_GetRef();
+	entry.name = GetNameSafe(object);
+	entry.stage = stage;
+	entry.time = FPlatformTime::Seconds();
+}
+
+void FVRTickTrace::EndFrame()
+{
+	if (!capturing || GFrameCounter != captureFrame) return;
+	capturing = false;
+	CHECK_RETURN_WARNING(LogTickTrace, entries.Num() == 0, "Nothing was recorded on the captured frame %llu.", captureFrame);
+
+	// Print each stage in the order it ran relative to the first.
+	UE_LOG(LogTickTrace, Log, TEXT("Tick order on frame %llu:"), captureFrame);
+	double startTime = entries[0].time;
+	double inputTime = -1.0, lastHandleTime = -1.0, postPhysicsTime = -1.0;
+	for (int32 i = 0; i < entries.Num(); i++)
+	{
+		const FEntry& entry = entries[i];
+		UE_LOG(LogTickTrace, Log, TEXT("  %2i. +%.3fms %s (%s)"), i + 1, (entry.time - startTime) * 1000.0, *entry.name, GetStageName(entry.stage));
+
+		// Keep the times needed for the latency.
+		switch (entry.stage)
+		{
+		case EStage::InputSampled:
+			if (inputTime < 0.0) inputTime = entry.time;
+			break;
+		case EStage::HandleTargetSet:
+			lastHandleTime = entry.time;
+			break;
+		case EStage::PostPhysics:
+			if (postPhysicsTime < 0.0) postPhysicsTime = entry.time;
+			break;
+		default:
+			break;
+		}
+	}
+
+	// Print the latency from sampling the input to it being consumed.
+	CHECK_RETURN_WARNING(LogTickTrace, inputTime < 0.0, "The input was not sampled on the captured frame, the pose to physics latency is unknown.");
+	if (lastHandleTime >= inputTime)
+	{
+		UE_LOG(LogTickTrace, Log, TEXT("Input to handle targets: %.3fms"), (lastHandleTime - inputTime) * 1000.0);
+	}
+	else UE_LOG(LogTickTrace, Warning, TEXT("No handle targets were set after the input was sampled, handles are reading a stale pose."));
+	if (postPhysicsTime >= inputTime) UE_LOG(LogTickTrace, Log, TEXT("Input to post physics: %.3fms"), (postPhysicsTime - inputTime) * 1000.0);
+}
+
+void FVRTickTrace::PrintTickFunction(const TCHAR* label, const FTickFunction& function)
+{
+	const UEnum* groupEnum = StaticEnum<ETickingGroup>();
+	UE_LOG(LogTickTrace, Log, TEXT("%s: %s, %s"), label, *groupEnum->GetNameStringByValue((int64)function.TickGroup.GetValue()), function.IsTickFunctionEnabled() ? TEXT("enabled") : TEXT("disabled"));
+	for (const FTickPrerequisite& prerequisite : function.GetPrerequisites())
+	{
+		UE_LOG(LogTickTrace, Log, TEXT("    after %s"), *GetNameSafe(prerequisite.PrerequisiteObject.Get()));
+	}
+}
+
+const TCHAR* FVRTickTrace::GetStageName(EStage stage)
+{
+	switch (stage)
+	{
+	case EStage::InputSampled: return TEXT("input sampled");
+	case EStage::HandUpdated: return TEXT("hand updated");
+	case EStage::HandleTargetSet: return TEXT("handle target set");
+	case EStage::MovementUpdated: return TEXT("movement updated");
+	case EStage::PostPhysics: return TEXT("post physics");
+	default: return TEXT("unknown");
+	}
+}
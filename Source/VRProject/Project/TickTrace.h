@@ -0,0 +1,70 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+#include "CoreMinimal.h"
+
+/** Declare log type for the tick trace. */
+DECLARE_LOG_CATEGORY_EXTERN(LogTickTrace, Log, All);
+
+/** Define classes used. */
+struct FTickFunction;
+
+/** Records the order and time the player, hands, physics handles and movement actually ticked on a single frame, along with how long it took from
+ * sampling the input to the handle targets being set and to the first post physics tick. Started by the VR.TickGraph console command.
+ * NOTE: Recording is a single branch on a static flag when no capture is pending so the calls can stay in shipping tick functions. */
+class VRPROJECT_API FVRTickTrace
+{
+public:
+
+	/** Stages of the frame that are recorded. */
+	enum class EStage : uint8
+	{
+		InputSampled,
+		HandUpdated,
+		HandleTargetSet,
+		MovementUpdated,
+		PostPhysics
+	};
+
+	/** Capture the next frame. */
+	static void CaptureNextFrame();
+
+	/** @Return true if a capture is pending. */
+	static FORCEINLINE bool IsCapturing() { return capturing; }
+
+	/** Record that an object reached a stage of the frame, ignored if the frame isn't being captured.
+	 * @Param object, The object that ticked.
+	 * @Param stage, The stage it completed. */
+	static FORCEINLINE void Record(const UObject* object, EStage stage)
+	{
+		if (capturing) RecordInternal(object, stage);
+	}
+
+	/** Print the captured frame and stop capturing if it has finished. Called at the end of the frame. */
+	static void EndFrame();
+
+	/** Print a tick function along with its group and prerequisites.
+	 * @Param label, Name to print for the tick function.
+	 * @Param function, The tick function to print. */
+	static void PrintTickFunction(const TCHAR* label, const FTickFunction& function);
+
+private:
+
+	/** A single recorded stage. */
+	struct FEntry
+	{
+		FString name; /** Name of the object that ticked. */
+		EStage stage; /** The stage that was completed. */
+		double time; /** Time in seconds the stage was completed. */
+	};
+
+	static bool capturing; /** Is a capture pending or in progress. */
+	static uint64 captureFrame; /** The frame being captured. */
+	static TArray<FEntry> entries; /** Stages recorded on the captured frame. */
+
+	/** Add an entry if this is the captured frame. */
+	static void RecordInternal(const UObject* object, EStage stage);
+
+	/** @Return the display name of a stage. */
+	static const TCHAR* GetStageName(EStage stage);
+};
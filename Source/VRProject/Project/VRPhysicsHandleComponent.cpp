@@ -10,6 +10,7 @@
 #include "DrawDebugHelpers.h"
 #include "TimerManager.h"
 #include "VRFunctionLibrary.h"
+#include "Project/TickTrace.h"
 
 #if WITH_PHYSX
 #include "PhysXPublic.h"
@@ -34,6 +35,8 @@ UVRPhysicsHandleComponent::UVRPhysicsHandleComponent(const FObjectInitializer& O
  	grabbedBoneName = NAME_None;
     reposition = false;
     repositionDistance = 18.0f;
+	extraLocationOffset = FVector::ZeroVector;
+	extraLocalLocationOffset = FVector::ZeroVector;
 }
 
 void UVRPhysicsHandleComponent::OnUnregister()
@@ -104,6 +107,9 @@ void UVRPhysicsHandleComponent::TickComponent(float DeltaTime, enum ELevelTick T
             }
  		}
 
+		// Apply the local offset in the space of the targets rotation.
+		if (!extraLocalLocationOffset.IsZero()) targetTransform.AddToTranslation(targetTransform.GetRotation().RotateVector(extraLocalLocationOffset));
+
         // If reposition is enabled update it.
         if (reposition)
         {
@@ -130,6 +136,7 @@ void UVRPhysicsHandleComponent::TickComponent(float DeltaTime, enum ELevelTick T
  
  	// Update the transform of the physics handle.
  	UpdateHandleTransform(currentTransform);
+	FVRTickTrace::Record(this, FVRTickTrace::EStage::HandleTargetSet);
 }
 
 void UVRPhysicsHandleComponent::K2_CreateJointAndFollowLocationTarget(UPrimitiveComponent* comp, UPrimitiveComponent* target, FName boneName, 
@@ -247,13 +254,54 @@ void UVRPhysicsHandleComponent::CreateJoint(UPrimitiveComponent* comp, UPrimitiv
  	// Save variables to keep track of grabbed state.
  	grabbedComponent = comp;
  	grabbedBoneName = boneName;
- 
+ 	SaveGrabOffsets(target, grabLocation, grabOrientation);
+}
+
+void UVRPhysicsHandleComponent::RetargetJoint(UPrimitiveComponent* target, FVector jointLocation, FRotator jointOrientation, bool constrainRotation, FPhysicsHandleData interactableData)
+{
+	CHECK_RETURN(LogVRHandle, !grabbedComponent, "The VR Physics Handle %s, cannot retarget a joint as nothing is currently grabbed.", *GetName());
+
+ #if WITH_PHYSX && PHYSICS_INTERFACE_PHYSX
+ 	// Nothing to retarget if the joint failed to create.
+ 	FBodyInstance* BodyInstance = grabbedComponent->GetBodyInstance(grabbedBoneName);
+ 	if (!BodyInstance || !joint || !targetActor)
+ 	{
+ 		return;
+ 	}
+
+	// Get actor handle.
+	const FPhysicsActorHandle& ActorHandle = BodyInstance->GetPhysicsActorHandle();
+ 	FPhysicsCommand::ExecuteWrite(ActorHandle, [&](const FPhysicsActorHandle& Actor)
+ 	{
+ 		if (PxRigidActor* phsyActor = FPhysicsInterface::GetPxRigidActor_AssumesLocked(Actor))
+ 		{
+ 			// Use the given handle data, otherwise go back to the original data as the joint would be if it was re-created.
+ 			handleData = interactableData.handleDataEnabled ? interactableData : originalData;
+
+ 			// Move the joint frame on the grabbed actor and the kinematic target to the new joint transform.
+ 			PxTransform grabbedActorPose = phsyActor->getGlobalPose();
+ 			PxTransform jointTransform(U2PVector(jointLocation), U2PQuat(jointOrientation.Quaternion()));
+ 			joint->setLocalPose(PxJointActorIndex::eACTOR1, grabbedActorPose.transformInv(jointTransform));
+ 			targetActor->setGlobalPose(jointTransform);
+ 			targetTransform = currentTransform = P2UTransform(jointTransform);
+
+ 			// Apply the new drives.
+ 			rotationConstraint = constrainRotation;
+ 			ReinitJoint();
+ 		}
+ 	});
+ #endif // WITH_PHYSX
+
+	// Save the offsets from the new target.
+	SaveGrabOffsets(target, jointLocation, jointOrientation);
+}
+
+void UVRPhysicsHandleComponent::SaveGrabOffsets(UPrimitiveComponent* target, const FVector& grabLocation, const FRotator& grabOrientation)
+{
  	// Save the offset of the joint from the grabbed component.
  	FTransform grabbedCompTransform = grabbedComponent->GetComponentTransform();
  	jointTransformGrabbable.SetLocation(grabbedCompTransform.InverseTransformPositionNoScale(grabLocation));
  	jointTransformGrabbable.SetRotation(grabbedCompTransform.InverseTransformRotation(grabOrientation.Quaternion()));
-    grabbedOffset.SetLocation(target->GetComponentTransform().InverseTransformPositionNoScale(grabbedCompTransform.GetLocation()));
-    grabbedOffset.SetRotation(target->GetComponentTransform().InverseTransformRotation(grabbedCompTransform.GetRotation()));
  	
  	// If there is a target component get the relative transform and follow this in this components tick function.
  	if (target)
@@ -263,9 +311,16 @@ void UVRPhysicsHandleComponent::CreateJoint(UPrimitiveComponent* comp, UPrimitiv
  		FVector targetLocOffset = targetComponent->GetComponentTransform().InverseTransformPositionNoScale(grabLocation);
  		FRotator targetRotOffset = targetComponent->GetComponentTransform().InverseTransformRotation(grabOrientation.Quaternion()).Rotator();
  		targetOffset = FTransform(targetRotOffset, targetLocOffset, targetTransform.GetScale3D());
+		grabbedOffset.SetLocation(targetComponent->GetComponentTransform().InverseTransformPositionNoScale(grabbedCompTransform.GetLocation()));
+		grabbedOffset.SetRotation(targetComponent->GetComponentTransform().InverseTransformRotation(grabbedCompTransform.GetRotation()));
+ 	}
+ 	// Otherwise disable update target location as the target will be set manually.
+ 	else
+ 	{
+ 		targetComponent = nullptr;
+ 		grabbedOffset = FTransform::Identity;
+ 		handleData.updateTargetLocation = false;
  	}
- 	// Otherwise disable update target location.
- 	else handleData.updateTargetLocation = false;
 }
 
 void UVRPhysicsHandleComponent::TeleportGrabbedComp()
@@ -323,9 +378,9 @@ FTransform UVRPhysicsHandleComponent::GetGrabbedOffset()
 
 void UVRPhysicsHandleComponent::DestroyJoint()
 {
- 	// Destroy all physX actors.
+ 	// Destroy all physX actors. The joint is released even if the grabbed component has since been destroyed and cleared.
  #if WITH_PHYSX
- 	if (grabbedComponent)
+ 	if (grabbedComponent || joint)
  	{
  		if (joint)
  		{
@@ -349,7 +404,7 @@ void UVRPhysicsHandleComponent::DestroyJoint()
  
  		// Reset any grabbed pointers/variables also.
  		handleData = originalData;
- 		grabbedComponent->WakeRigidBody(grabbedBoneName);
+ 		if (IsValid(grabbedComponent)) grabbedComponent->WakeRigidBody(grabbedBoneName);
  		grabbedComponent = NULL;
  		grabbedBoneName = NAME_None;
  
@@ -391,6 +446,11 @@ void UVRPhysicsHandleComponent::SetLocationOffset(FVector newOffset)
     extraLocationOffset = newOffset;
 }
 
+void UVRPhysicsHandleComponent::SetLocalLocationOffset(FVector newOffset)
+{
+	extraLocalLocationOffset = newOffset;
+}
+
 void UVRPhysicsHandleComponent::SetRotationOffset(FRotator newOffset)
 {
 	extraRotationOffset = newOffset;
@@ -271,6 +271,14 @@ public:
 	void CreateJointAndFollowLocationWithRotation(UPrimitiveComponent* comp, FName boneName, FVector jointLocation, FRotator jointOrientation, 
 		FPhysicsHandleData interactableData = FPhysicsHandleData());
 
+	/** Move the current joint to a new location and target without destroying and re-creating it. Used to hand over from a manually targeted joint to a followed one.
+	 * @Param target, The target component to be followed relative to the jointLocation, if null the target must be set manually.
+	 * @Param jointLocation, The new reference location in the world for the joint.
+	 * @Param jointOrientation, The new reference rotation in the world for the joint.
+	 * @Param constrainRotation, Should the joint update any rotational values when constrained.
+	 * @Param interactableData, The FPhysicsHandleData structure to be used from now on, NOTE: handleDataEnabled needs to be true otherwise the original data is used. */
+	void RetargetJoint(UPrimitiveComponent* target, FVector jointLocation, FRotator jointOrientation, bool constrainRotation, FPhysicsHandleData interactableData = FPhysicsHandleData());
+
 	/** Destroy the joint created when grabbed. NOTE: Equivalent of normal physics handles releaseComponent function. */
 	UFUNCTION(BlueprintCallable, Category = "Physics|Components|VRPhysicsHandle")
 	void DestroyJoint();
@@ -284,6 +292,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Physics|Components|VRPhysicsHandle")
 	void SetLocationOffset(FVector newOffset);
 
+	/** Adjust target offset post grab by adding an amount in the targets local space, so it follows the targets rotation without being updated every frame. */
+	UFUNCTION(BlueprintCallable, Category = "Physics|Components|VRPhysicsHandle")
+	void SetLocalLocationOffset(FVector newOffset);
+
 
 
 	void SetRotationOffset(FRotator newOffset);
@@ -348,6 +360,7 @@ protected:
 	physx::PxRigidDynamic* targetActor; /** Pointer to target actor created in the create joint function to constrain a given component to. */
 	FTransform targetOffset; /** Relative offset transform from the target component that the constraint was initialized / positioned. */
 	FVector extraLocationOffset; /** Extra location offset to target from the targetOffset transform. */
+	FVector extraLocalLocationOffset; /** Extra location offset in the target transforms local space. */
 	FRotator extraRotationOffset; /** Extra rotation offset to target from the targetOffset transform. */
 	FTransform grabbedOffset; /** Saved grabbable offset to the hand. */
 	bool rotationConstraint; /** Is the rotation constraint currently active. */
@@ -372,6 +385,12 @@ protected:
 	void CreateJoint(UPrimitiveComponent* comp, UPrimitiveComponent* target, FName boneName, const FVector& grabLocation, const FRotator& grabOrientation,
 		bool constrainRotation = false, FPhysicsHandleData interactableData = FPhysicsHandleData());
 
+	/** Save the offsets of the joint from the grabbed component and the target component.
+	 * @Param target, The target component to be followed, if null updating the target location is disabled.
+	 * @Param grabLocation, The reference location of the joint in the world.
+	 * @Param grabOrientation, The reference rotation of the joint in the world. */
+	void SaveGrabOffsets(UPrimitiveComponent* target, const FVector& grabLocation, const FRotator& grabOrientation);
+
 	/** Update the transform transform of the joint if one currently exists.
 	 * @Param updatedTransform, The new updated location/rotation for the transform. */
 	void UpdateHandleTransform(const FTransform& updatedTransform);
@@ -32,7 +32,8 @@ public class VRProject : ModuleRules
             "PhysicsCore", 
             "PhysX" , 
             "APEX",  
-            "GameplayTasks"
+            "GameplayTasks",
+            "ProceduralMeshComponent"
         });
 
         PrivateDependencyModuleNames.AddRange(new string[] 